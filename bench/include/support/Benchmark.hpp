@@ -0,0 +1,177 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/**
+ * @file Benchmark.hpp
+ * @brief a small harness for timing the phases of the compiler
+ * @version 0.1
+ */
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pink::bench {
+/**
+ * @brief times the region of a single iteration between
+ * Start and Stop, such that each iteration may do it's
+ * setup outside of the measurement.
+ */
+class Timer {
+private:
+  using Clock = std::chrono::steady_clock;
+  Clock::time_point start;
+  Clock::duration   elapsed{};
+
+public:
+  void Start() noexcept { start = Clock::now(); }
+  void Stop() noexcept { elapsed += Clock::now() - start; }
+
+  [[nodiscard]] auto Nanoseconds() const noexcept -> double {
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+};
+
+/**
+ * @brief the given percentile, in [0, 1], of the values,
+ * interpolating between the closest ranks.
+ */
+inline auto Percentile(std::vector<double> values, double percentile)
+    -> double {
+  std::sort(values.begin(), values.end());
+  auto rank = percentile * static_cast<double>(values.size() - 1);
+  auto low  = static_cast<std::size_t>(rank);
+  auto high = std::min(low + 1, values.size() - 1);
+  auto frac = rank - static_cast<double>(low);
+  return values[low] + (values[high] - values[low]) * frac;
+}
+
+/**
+ * @brief the samples taken of a single benchmark
+ */
+struct Result {
+  std::string         name;
+  std::string         input;
+  std::size_t         bytes;
+  std::vector<double> samples;
+
+  [[nodiscard]] auto Min() const -> double {
+    return *std::min_element(samples.begin(), samples.end());
+  }
+  [[nodiscard]] auto Max() const -> double {
+    return *std::max_element(samples.begin(), samples.end());
+  }
+  [[nodiscard]] auto Mean() const -> double {
+    return std::accumulate(samples.begin(), samples.end(), 0.0) /
+           static_cast<double>(samples.size());
+  }
+  [[nodiscard]] auto Median() const -> double {
+    auto sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    auto middle = sorted.size() / 2;
+    if ((sorted.size() % 2) == 0) {
+      return (sorted[middle - 1] + sorted[middle]) / 2.0;
+    }
+    return sorted[middle];
+  }
+};
+
+/**
+ * @brief runs each benchmark for a number of iterations,
+ * after a single warmup iteration, and reports the results
+ * as JSON.
+ */
+class Suite {
+private:
+  std::size_t         iterations;
+  std::vector<Result> results;
+
+public:
+  explicit Suite(std::size_t iterations)
+      : iterations{std::max<std::size_t>(iterations, 1)} {}
+
+  [[nodiscard]] auto GetResults() const -> const std::vector<Result> & {
+    return results;
+  }
+
+  /**
+   * @brief runs body(timer) for each iteration
+   *
+   * @param body returns false if the iteration failed, which
+   * stops the benchmark.
+   * @return false if any iteration failed
+   */
+  template <class Body>
+  auto Run(std::string_view name,
+           std::string_view input,
+           std::size_t      bytes,
+           Body           &&body) -> bool {
+    Result result{std::string{name}, std::string{input}, bytes, {}};
+    result.samples.reserve(iterations);
+
+    Timer warmup;
+    if (!body(warmup)) {
+      return false;
+    }
+
+    for (std::size_t iteration = 0; iteration < iterations; ++iteration) {
+      Timer timer;
+      if (!body(timer)) {
+        return false;
+      }
+      result.samples.emplace_back(timer.Nanoseconds());
+    }
+
+    results.emplace_back(std::move(result));
+    return true;
+  }
+
+  /**
+   * @brief prints the results as JSON
+   *
+   * #NOTE: the names of benchmarks and inputs are our own,
+   * so they are never escaped.
+   */
+  auto PrintJSON(std::ostream &out) const -> std::ostream & {
+    out << "{\n  \"iterations\": " << iterations << ",\n  \"benchmarks\": [";
+    bool first = true;
+    for (const auto &result : results) {
+      out << (first ? "\n" : ",\n");
+      first = false;
+
+      auto median = result.Median();
+      out << "    {\"name\": \"" << result.name << "\", \"input\": \""
+          << result.input << "\", \"bytes\": " << result.bytes
+          << ", \"min_ns\": " << result.Min()
+          << ", \"median_ns\": " << median << ", \"mean_ns\": "
+          << result.Mean() << ", \"max_ns\": " << result.Max();
+      if (median > 0.0) {
+        out << ", \"bytes_per_second\": "
+            << static_cast<double>(result.bytes) * 1.0e9 / median;
+      }
+      out << "}";
+    }
+    out << "\n  ]\n}\n";
+    return out;
+  }
+};
+} // namespace pink::bench
@@ -0,0 +1,65 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/**
+ * @file Generator.hpp
+ * @brief Header for the synthetic program generator
+ * @version 0.1
+ */
+#pragma once
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace pink::bench {
+/**
+ * @brief the parameters which control the shape of a
+ * generated program
+ */
+struct Shape {
+  std::size_t functions       = 100; // the number of functions
+  std::size_t depth           = 2;   // the nesting depth of if and while
+  std::size_t expression_size = 4;   // the number of binops per expression
+  std::size_t types           = 4;   // the number of distinct tuple types
+  std::size_t array_size      = 8;   // the length of each array literal
+  std::size_t globals         = 8;   // the number of global variables
+
+  struct Parameter {
+    std::string_view name;
+    std::size_t Shape::*member;
+  };
+
+  static constexpr std::array<Parameter, 6> parameters{
+      Parameter{"functions", &Shape::functions},
+      Parameter{"depth", &Shape::depth},
+      Parameter{"expression_size", &Shape::expression_size},
+      Parameter{"types", &Shape::types},
+      Parameter{"array_size", &Shape::array_size},
+      Parameter{"globals", &Shape::globals},
+  };
+};
+
+/**
+ * @brief generates a valid pink program with the given shape
+ *
+ * function f_i calls f_(i-1), and main calls the last function,
+ * so every function is reachable from main. every loop has a
+ * constant trip count, so the generated program terminates.
+ */
+auto GenerateProgram(const Shape &shape) -> std::string;
+} // namespace pink::bench
@@ -0,0 +1,245 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/**
+ * @file Process.hpp
+ * @brief runs a child process and measures it
+ * @version 0.1
+ */
+#pragma once
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace pink::bench {
+/**
+ * @brief the measurements of a single run of a child process
+ */
+struct Execution {
+  bool                         exited;    // did the child exit normally?
+  int                          exit_code; // valid iff exited
+  double                       wall_ms;
+  long                         peak_rss_kb;
+  std::optional<std::uint64_t> instructions; // iff perf counters work
+  std::optional<std::uint64_t> syscalls;     // iff perf counters work
+};
+
+/**
+ * @brief counts an event of this process and it's children,
+ * if perf counters are available.
+ *
+ * the counter is inherited, so the counts of each child are
+ * added to it when the child exits.
+ */
+class PerfCounter {
+private:
+  int descriptor = -1;
+
+protected:
+  explicit PerfCounter(std::optional<perf_event_attr> attributes) noexcept {
+    if (!attributes) {
+      return;
+    }
+    attributes->size     = sizeof(perf_event_attr);
+    attributes->disabled = 1;
+    attributes->inherit  = 1;
+    descriptor           = static_cast<int>(
+        syscall(SYS_perf_event_open, &*attributes, 0, -1, -1, 0));
+  }
+
+public:
+  ~PerfCounter() noexcept {
+    if (descriptor >= 0) {
+      close(descriptor);
+    }
+  }
+  PerfCounter(const PerfCounter &)                     = delete;
+  PerfCounter(PerfCounter &&)                          = delete;
+  auto operator=(const PerfCounter &) -> PerfCounter & = delete;
+  auto operator=(PerfCounter &&) -> PerfCounter      & = delete;
+
+  [[nodiscard]] auto IsAvailable() const noexcept -> bool {
+    return descriptor >= 0;
+  }
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-vararg)
+  void Start() const noexcept {
+    ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+    ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+  }
+  void Stop() const noexcept { ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0); }
+  // NOLINTEND(cppcoreguidelines-pro-type-vararg)
+
+  [[nodiscard]] auto Read() const noexcept -> std::optional<std::uint64_t> {
+    std::uint64_t count = 0;
+    if (read(descriptor, &count, sizeof(count)) != sizeof(count)) {
+      return {};
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief counts the instructions retired in user space
+ */
+class InstructionCounter : public PerfCounter {
+private:
+  static auto Attributes() noexcept -> perf_event_attr {
+    perf_event_attr attributes{};
+    attributes.type           = PERF_TYPE_HARDWARE;
+    attributes.config         = PERF_COUNT_HW_INSTRUCTIONS;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv     = 1;
+    return attributes;
+  }
+
+public:
+  InstructionCounter() noexcept : PerfCounter(Attributes()) {}
+};
+
+/**
+ * @brief counts the system calls made, through the
+ * raw_syscalls:sys_enter tracepoint. the count includes the
+ * fork and wait4 made by Execute around each child.
+ *
+ * the tracepoint is only available when tracefs is mounted
+ * and readable, and perf_event_paranoid allows tracepoints.
+ */
+class SyscallCounter : public PerfCounter {
+private:
+  static auto Attributes() noexcept -> std::optional<perf_event_attr> {
+    for (const auto *tracefs : {"/sys/kernel/tracing",
+                                "/sys/kernel/debug/tracing"}) {
+      std::ifstream file{std::string{tracefs} +
+                         "/events/raw_syscalls/sys_enter/id"};
+      std::uint64_t identifier = 0;
+      if (file >> identifier) {
+        perf_event_attr attributes{};
+        attributes.type   = PERF_TYPE_TRACEPOINT;
+        attributes.config = identifier;
+        return attributes;
+      }
+    }
+    return std::nullopt;
+  }
+
+public:
+  SyscallCounter() noexcept : PerfCounter(Attributes()) {}
+};
+
+inline auto Now() noexcept -> double {
+  timespec time{};
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return static_cast<double>(time.tv_sec) * 1.0e3 +
+         static_cast<double>(time.tv_nsec) / 1.0e6;
+}
+
+/**
+ * @brief runs arguments[0], searching the PATH, and waits
+ * for it to finish.
+ *
+ * @param counter if given and available, the instructions retired
+ * by the child are counted.
+ * @param syscalls if given and available, the system calls made
+ * by the child are counted.
+ * @param discard_output if true, the standard output of the child
+ * is written to /dev/null.
+ * @return the measurements, or nothing if the child could not be
+ * started.
+ */
+inline auto Execute(const std::vector<std::string> &arguments,
+                    const InstructionCounter       *counter        = nullptr,
+                    const SyscallCounter           *syscalls       = nullptr,
+                    bool                            discard_output = false)
+    -> std::optional<Execution> {
+  std::vector<char *> argv;
+  argv.reserve(arguments.size() + 1);
+  for (const auto &argument : arguments) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    argv.emplace_back(const_cast<char *>(argument.c_str()));
+  }
+  argv.emplace_back(nullptr);
+
+  auto counting = (counter != nullptr) && counter->IsAvailable();
+  if (counting) {
+    counter->Start();
+  }
+  auto counting_syscalls = (syscalls != nullptr) && syscalls->IsAvailable();
+  if (counting_syscalls) {
+    syscalls->Start();
+  }
+
+  auto  start = Now();
+  pid_t pid   = fork();
+  if (pid < 0) {
+    std::cerr << "fork failed [" << std::strerror(errno) << "]\n";
+    return {};
+  }
+
+  if (pid == 0) {
+    if (discard_output) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+      int null = open("/dev/null", O_WRONLY);
+      if (null >= 0) {
+        dup2(null, STDOUT_FILENO);
+        close(null);
+      }
+    }
+    execvp(argv[0], argv.data());
+    std::cerr << "execvp [" << arguments[0] << "] failed ["
+              << std::strerror(errno) << "]\n";
+    _exit(EXIT_FAILURE);
+  }
+
+  int           status = 0;
+  struct rusage usage {};
+  if (wait4(pid, &status, 0, &usage) < 0) {
+    std::cerr << "wait4 failed [" << std::strerror(errno) << "]\n";
+    return {};
+  }
+  auto stop = Now();
+
+  Execution execution{};
+  if (counting) {
+    counter->Stop();
+    execution.instructions = counter->Read();
+  }
+  if (counting_syscalls) {
+    syscalls->Stop();
+    execution.syscalls = syscalls->Read();
+  }
+  execution.exited      = WIFEXITED(status);
+  execution.exit_code   = execution.exited ? WEXITSTATUS(status) : -1;
+  execution.wall_ms     = stop - start;
+  execution.peak_rss_kb = usage.ru_maxrss;
+  return execution;
+}
+} // namespace pink::bench
@@ -0,0 +1,71 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/**
+ * @file Programs.hpp
+ * @brief the programs which the benchmarks compile
+ * @version 0.1
+ */
+#pragma once
+#include <string_view>
+
+namespace pink::bench {
+/*
+  a small program using most of the language, such as
+  it is written by hand.
+*/
+constexpr inline std::string_view representative_program =
+    "fn square(x: Integer) { x * x; }\n"
+    "\n"
+    "fn sum_of_squares(n: Integer) {\n"
+    "  i := 0;\n"
+    "  sum := 0;\n"
+    "  while i < n do {\n"
+    "    sum = sum + square(i);\n"
+    "    i = i + 1;\n"
+    "  }\n"
+    "  sum;\n"
+    "}\n"
+    "\n"
+    "fn maximum(a: Integer, b: Integer) {\n"
+    "  m := 0;\n"
+    "  if (a < b) { m = b; } else { m = a; }\n"
+    "  m;\n"
+    "}\n"
+    "\n"
+    "fn collatz(n: Integer) {\n"
+    "  steps := 0;\n"
+    "  x := n;\n"
+    "  while x != 1 do {\n"
+    "    if (x % 2 == 0) { x = x / 2; } else { x = 3 * x + 1; }\n"
+    "    steps = steps + 1;\n"
+    "  }\n"
+    "  steps;\n"
+    "}\n"
+    "\n"
+    "fn lookup(i: Integer) {\n"
+    "  table := [1, 1, 2, 3, 5, 8, 13, 21];\n"
+    "  table[i % 8];\n"
+    "}\n"
+    "\n"
+    "fn main() {\n"
+    "  a := sum_of_squares(100);\n"
+    "  b := collatz(27);\n"
+    "  c := lookup(a);\n"
+    "  maximum(a + b, c) % 256;\n"
+    "}\n";
+} // namespace pink::bench
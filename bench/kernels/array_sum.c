@@ -0,0 +1,23 @@
+#include <stdint.h>
+
+struct array {
+  int64_t elements[8];
+};
+
+static int64_t sum(struct array a) {
+  int64_t s = 0;
+  for (int64_t i = 0; i < 8; i++) {
+    s = s + a.elements[i];
+  }
+  return s;
+}
+
+int main(void) {
+  struct array a     = {{1, 2, 3, 4, 5, 6, 7, 8}};
+  int64_t      total = 0;
+  for (int64_t n = 0; n < 10000000; n++) {
+    a.elements[n % 8] = n % 1000;
+    total             = (total + sum(a)) % 1000003;
+  }
+  return (int)(total % 256);
+}
@@ -0,0 +1,23 @@
+fn sum(a: [Integer; 8]) {
+  i := 0;
+  s := 0;
+  while i < 8 do {
+    s = s + a[i];
+    i = i + 1;
+  }
+  s;
+}
+
+fn main() {
+  a := [1, 2, 3, 4, 5, 6, 7, 8];
+  n := 0;
+  k := 0;
+  total := 0;
+  while n < 10000000 do {
+    k = n % 8;
+    a[k] = n % 1000;
+    total = (total + sum(a)) % 1000003;
+    n = n + 1;
+  }
+  total % 256;
+}
@@ -0,0 +1,19 @@
+#include <stdint.h>
+
+static int64_t f0(int64_t x) { return (x + 1) % 1000003; }
+
+static int64_t f1(int64_t x) { return (f0(x) * 3) % 1000003; }
+
+static int64_t f2(int64_t x) { return (f1(x) + f0(x)) % 1000003; }
+
+static int64_t f3(int64_t x) { return (f2(x) * f1(x)) % 1000003; }
+
+static int64_t f4(int64_t x) { return (f3(x) + f2(x)) % 1000003; }
+
+int main(void) {
+  int64_t x = 0;
+  for (int64_t n = 0; n < 5000000; n++) {
+    x = f4(x);
+  }
+  return (int)(x % 256);
+}
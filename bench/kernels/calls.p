@@ -0,0 +1,19 @@
+fn f0(x: Integer) { (x + 1) % 1000003; }
+
+fn f1(x: Integer) { (f0(x) * 3) % 1000003; }
+
+fn f2(x: Integer) { (f1(x) + f0(x)) % 1000003; }
+
+fn f3(x: Integer) { (f2(x) * f1(x)) % 1000003; }
+
+fn f4(x: Integer) { (f3(x) + f2(x)) % 1000003; }
+
+fn main() {
+  n := 0;
+  x := 0;
+  while n < 5000000 do {
+    x = f4(x);
+    n = n + 1;
+  }
+  x % 256;
+}
@@ -0,0 +1,10 @@
+#include <stdint.h>
+
+int main(void) {
+  int64_t h[16] = {0};
+  for (int64_t i = 0; i < 10000000; i++) {
+    int64_t k = (i * 7 + i / 3) % 16;
+    h[k]      = h[k] + 1;
+  }
+  return (int)((h[3] + h[11]) % 256);
+}
@@ -0,0 +1,11 @@
+fn main() {
+  h := [0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0];
+  i := 0;
+  k := 0;
+  while i < 10000000 do {
+    k = (i * 7 + i / 3) % 16;
+    h[k] = h[k] + 1;
+    i = i + 1;
+  }
+  (h[3] + h[11]) % 256;
+}
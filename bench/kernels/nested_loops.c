@@ -0,0 +1,13 @@
+#include <stdint.h>
+
+int main(void) {
+  int64_t s = 0;
+  for (int64_t i = 0; i < 300; i++) {
+    for (int64_t j = 0; j < 300; j++) {
+      for (int64_t k = 0; k < 300; k++) {
+        s = s + (i * j + k) % 7;
+      }
+    }
+  }
+  return (int)(s % 256);
+}
@@ -0,0 +1,19 @@
+fn main() {
+  i := 0;
+  j := 0;
+  k := 0;
+  s := 0;
+  while i < 300 do {
+    j = 0;
+    while j < 300 do {
+      k = 0;
+      while k < 300 do {
+        s = s + (i * j + k) % 7;
+        k = k + 1;
+      }
+      j = j + 1;
+    }
+    i = i + 1;
+  }
+  s % 256;
+}
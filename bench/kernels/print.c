@@ -0,0 +1,12 @@
+#include <stdint.h>
+#include <stdio.h>
+
+int main(void) {
+  uint8_t line[8] = {'p', 'r', 'i', 'n', 't', ' ', '0', '\n'};
+  int64_t i       = 0;
+  for (; i < 1000000; i++) {
+    line[6] = (uint8_t)(48 + i % 10);
+    fwrite(line, 1, sizeof(line), stdout);
+  }
+  return (int)(i % 256);
+}
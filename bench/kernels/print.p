@@ -0,0 +1,10 @@
+fn main() {
+  line := [u8(112), u8(114), u8(105), u8(110), u8(116), u8(32), u8(48), u8(10)];
+  i := 0;
+  while i < 1000000 do {
+    line[6] = u8(48 + i % 10);
+    print(line);
+    i = i + 1;
+  }
+  i % 256;
+}
@@ -0,0 +1,13 @@
+#include <stdint.h>
+
+int main(void) {
+  int64_t a[16] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3};
+  int64_t total = 0;
+  for (int64_t n = 0; n < 1000000; n++) {
+    for (int64_t j = 0; j < 16; j++) {
+      a[j] = (a[j] + a[(j + n) % 16] + a[3]) % 1000;
+    }
+    total = (total + a[n % 16]) % 1000003;
+  }
+  return (int)(total % 256);
+}
@@ -0,0 +1,16 @@
+fn main() {
+  a := [3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3];
+  n := 0;
+  j := 0;
+  total := 0;
+  while n < 1000000 do {
+    j = 0;
+    while j < 16 do {
+      a[j] = (a[j] + a[(j + n) % 16] + a[3]) % 1000;
+      j = j + 1;
+    }
+    total = (total + a[n % 16]) % 1000003;
+    n = n + 1;
+  }
+  total % 256;
+}
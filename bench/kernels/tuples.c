@@ -0,0 +1,19 @@
+#include <stdint.h>
+
+struct pair {
+  int64_t first;
+  int64_t second;
+};
+
+static struct pair step(struct pair p) {
+  struct pair result = {p.second, (p.first + p.second) % 1000003};
+  return result;
+}
+
+int main(void) {
+  struct pair p = {0, 1};
+  for (int64_t n = 0; n < 10000000; n++) {
+    p = step(p);
+  }
+  return (int)(p.first % 256);
+}
@@ -0,0 +1,13 @@
+fn step(p: (Integer, Integer)) {
+  (p.1, (p.0 + p.1) % 1000003);
+}
+
+fn main() {
+  p := (0, 1);
+  n := 0;
+  while n < 10000000 do {
+    p = step(p);
+    n = n + 1;
+  }
+  p.0 % 256;
+}
@@ -0,0 +1,200 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "support/Generator.hpp"
+
+namespace pink::bench {
+namespace {
+/*
+  the generated functions all have the form
+
+  fn f_i(x: Integer) {
+    t := (x, x, ...);            the i'th of the distinct tuple types
+    a := [0, 1, 2, ...];         an array literal of array_size
+    k := x % array_size;         x is always positive, so k is in bounds
+    c_2 := 0; c_4 := 0; ...      the counters of the nested loops
+    r := f_(i-1)(x) + <expr>;
+    <nested if and while, to depth, each adding an <expr> to r>
+    r;
+  }
+
+  all of the bound names are unique within each function,
+  and nothing is bound within a nested block.
+*/
+class Generator {
+private:
+  const Shape &shape;
+  std::string  program;
+  std::size_t  function = 0;
+  std::size_t  operand  = 0;
+
+  auto TupleArity() const -> std::size_t {
+    return 2 + (function % shape.types);
+  }
+
+  void Operand(bool within_body) {
+    // cycles through every kind of operand
+    static constexpr std::size_t kinds = 6;
+    auto                         kind  = operand++ % kinds;
+    switch (kind) {
+    case 0:
+      program += "x";
+      return;
+    case 1:
+      program += std::to_string((operand % 97) + 1);
+      return;
+    case 2:
+      if (shape.globals != 0) {
+        program += "g_" + std::to_string((function + operand) % shape.globals);
+        return;
+      }
+      break;
+    case 3:
+      if (shape.types != 0) {
+        program += "t." + std::to_string(operand % TupleArity());
+        return;
+      }
+      break;
+    case 4:
+      if (shape.array_size != 0) {
+        program += "a[k]";
+        return;
+      }
+      break;
+    default:
+      if (within_body) {
+        program += "r";
+        return;
+      }
+      break;
+    }
+    program += "x";
+  }
+
+  void Expression(bool within_body) {
+    static constexpr std::array<std::string_view, 3> binops{" + ",
+                                                            " - ",
+                                                            " * "};
+    Operand(within_body);
+    for (std::size_t index = 0; index < shape.expression_size; ++index) {
+      program += binops[(operand + index) % binops.size()];
+      Operand(within_body);
+    }
+  }
+
+  void Indent(std::size_t level) { program.append(2 * level, ' '); }
+
+  void Nested(std::size_t level, std::size_t indent) {
+    if (level == 0) {
+      Indent(indent);
+      program += "r = r + ";
+      Expression(true);
+      program += ";\n";
+      return;
+    }
+
+    auto counter = "c_" + std::to_string(level);
+    if ((level % 2) == 0) {
+      Indent(indent);
+      program += counter + " = 0;\n";
+      Indent(indent);
+      program += "while " + counter + " < 2 do {\n";
+      Nested(level - 1, indent + 1);
+      Indent(indent + 1);
+      program += counter + " = " + counter + " + 1;\n";
+      Indent(indent);
+      program += "}\n";
+    } else {
+      Indent(indent);
+      program += "if (r < " + std::to_string(1000 * level) + ") {\n";
+      Nested(level - 1, indent + 1);
+      Indent(indent);
+      program += "} else {\n";
+      Indent(indent + 1);
+      program += "r = r - " + std::to_string(level) + ";\n";
+      Indent(indent);
+      program += "}\n";
+    }
+  }
+
+  void Function() {
+    program += "fn f_" + std::to_string(function) + "(x: Integer) {\n";
+
+    if (shape.types != 0) {
+      program += "  t := (x";
+      for (std::size_t index = 1; index < TupleArity(); ++index) {
+        program += ", x";
+      }
+      program += ");\n";
+    }
+
+    if (shape.array_size != 0) {
+      program += "  a := [0";
+      for (std::size_t index = 1; index < shape.array_size; ++index) {
+        program += ", " + std::to_string(index);
+      }
+      program += "];\n";
+      program += "  k := x % " + std::to_string(shape.array_size) + ";\n";
+    }
+
+    // the even levels are loops, the odd levels are conditionals
+    for (std::size_t level = 2; level <= shape.depth; level += 2) {
+      program += "  c_" + std::to_string(level) + " := 0;\n";
+    }
+
+    program += "  r := ";
+    if (function != 0) {
+      program += "f_" + std::to_string(function - 1) + "(x) + ";
+    }
+    Expression(false);
+    program += ";\n";
+
+    Nested(shape.depth, 1);
+
+    program += "  r;\n}\n\n";
+  }
+
+public:
+  explicit Generator(const Shape &shape) : shape{shape} {}
+
+  auto Generate() -> std::string {
+    for (std::size_t index = 0; index < shape.globals; ++index) {
+      program += "g_" + std::to_string(index) + " := " +
+                 std::to_string(index + 1) + ";\n";
+    }
+    program += "\n";
+
+    for (function = 0; function < shape.functions; ++function) {
+      Function();
+    }
+
+    program += "fn main() {\n";
+    if (shape.functions != 0) {
+      program += "  f_" + std::to_string(shape.functions - 1) + "(7) % 256;\n";
+    } else {
+      program += "  0;\n";
+    }
+    program += "}\n";
+    return std::move(program);
+  }
+};
+} // namespace
+
+auto GenerateProgram(const Shape &shape) -> std::string {
+  return Generator{shape}.Generate();
+}
+} // namespace pink::bench
@@ -0,0 +1,106 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/*
+  pink_generate writes a synthetic pink program of the
+  given shape, for finding where the compiler scales poorly.
+
+  pink_generate [--functions <n>] [--depth <n>] [--expression-size <n>]
+                [--types <n>] [--array-size <n>] [--globals <n>]
+                [-o <output file>]
+*/
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <string>
+
+#include "support/Generator.hpp"
+
+auto main(int argc, char **argv) -> int {
+  pink::bench::Shape shape;
+  std::string        output_file;
+
+  // NOLINTBEGIN
+  static struct option long_options[] = {
+      {"functions", required_argument, nullptr, 'f'},
+      {"depth", required_argument, nullptr, 'd'},
+      {"expression-size", required_argument, nullptr, 'e'},
+      {"types", required_argument, nullptr, 't'},
+      {"array-size", required_argument, nullptr, 'a'},
+      {"globals", required_argument, nullptr, 'g'},
+      {"output", required_argument, nullptr, 'o'},
+      {nullptr, 0, nullptr, 0}};
+
+  int option = 0;
+  while ((option = getopt_long(argc,
+                               argv,
+                               "f:d:e:t:a:g:o:",
+                               long_options,
+                               nullptr)) != -1) {
+    switch (option) {
+    case 'f': {
+      shape.functions = std::stoul(optarg);
+      break;
+    }
+    case 'd': {
+      shape.depth = std::stoul(optarg);
+      break;
+    }
+    case 'e': {
+      shape.expression_size = std::stoul(optarg);
+      break;
+    }
+    case 't': {
+      shape.types = std::stoul(optarg);
+      break;
+    }
+    case 'a': {
+      shape.array_size = std::stoul(optarg);
+      break;
+    }
+    case 'g': {
+      shape.globals = std::stoul(optarg);
+      break;
+    }
+    case 'o': {
+      output_file = optarg;
+      break;
+    }
+    default: {
+      std::cerr << "pink_generate [--functions <n>] [--depth <n>] "
+                   "[--expression-size <n>] [--types <n>] [--array-size <n>] "
+                   "[--globals <n>] [-o <output file>]\n";
+      return EXIT_FAILURE;
+    }
+    }
+  }
+  // NOLINTEND
+
+  auto program = pink::bench::GenerateProgram(shape);
+  if (output_file.empty()) {
+    std::cout << program;
+    return EXIT_SUCCESS;
+  }
+
+  std::ofstream output{output_file};
+  if (!output.is_open()) {
+    std::cerr << "Could not open output file [" << output_file << "]\n";
+    return EXIT_FAILURE;
+  }
+  output << program;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,346 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/*
+  pink_kernels measures the quality of the code which pink
+  generates. each kernel in the kernel directory is a pink
+  program (name.p) along with an equivalent C program (name.c).
+  both are compiled at -O0 through -O3, run a number of times,
+  and timed. the C program is compiled with clang, such that
+  both programs share the same backend. where perf counters
+  are available, the instructions retired and the system calls
+  made are counted as well. the output of each program is
+  discarded, so print heavy kernels measure the cost of writing
+  rather than that of the terminal.
+
+  the pink program is also compiled with bounds checks hoisted
+  and with bounds checks off, so the cost of the checks which
+  remain after elimination is recorded against the unchecked
+  program.
+
+  pink_kernels [-k <kernel directory>] [-n <runs>] [-p <pink executable>]
+               [-c <c compiler>] [-o <output file>]
+
+  each pair of programs must exit with the same value, otherwise
+  pink_kernels exits with EXIT_FAILURE.
+*/
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <getopt.h>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "support/Benchmark.hpp"
+#include "support/Process.hpp"
+
+#include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+constexpr std::array<std::string_view, 4> levels{"0", "1", "2", "3"};
+// the bounds checks modes measured besides the default, and the
+// name each is recorded under.
+constexpr std::array<std::pair<const char *, const char *>, 2> bounds_checks{
+    {{"hoisted", "pink_hoisted"}, {"off", "pink_unchecked"}}};
+
+struct Runs {
+  int                          exit_code;
+  double                       median_ms;
+  double                       min_ms;
+  std::optional<std::uint64_t> instructions; // the median
+  std::optional<std::uint64_t> syscalls;     // the median
+};
+
+auto Median(std::vector<std::uint64_t> &counts)
+    -> std::optional<std::uint64_t> {
+  if (counts.empty()) {
+    return {};
+  }
+  std::sort(counts.begin(), counts.end());
+  return counts[counts.size() / 2];
+}
+
+auto Compile(const std::vector<std::string> &arguments) -> bool {
+  auto execution = pink::bench::Execute(arguments);
+  if (!execution || !execution->exited ||
+      (execution->exit_code != EXIT_SUCCESS)) {
+    std::cerr << "Could not compile [" << arguments.back() << "]\n";
+    return false;
+  }
+  return true;
+}
+
+auto Run(const fs::path                        &program,
+         std::size_t                            runs,
+         const pink::bench::InstructionCounter &counter,
+         const pink::bench::SyscallCounter     &syscall_counter)
+    -> std::optional<Runs> {
+  std::vector<double>        wall_ms;
+  std::vector<std::uint64_t> instructions;
+  std::vector<std::uint64_t> syscalls;
+  int                        exit_code = 0;
+
+  // the first run is a warmup
+  for (std::size_t run = 0; run <= runs; ++run) {
+    auto execution = pink::bench::Execute({program},
+                                          &counter,
+                                          &syscall_counter,
+                                          /* discard_output */ true);
+    if (!execution || !execution->exited) {
+      std::cerr << "[" << program.string() << "] did not exit normally\n";
+      return {};
+    }
+    if (run == 0) {
+      exit_code = execution->exit_code;
+      continue;
+    }
+    wall_ms.emplace_back(execution->wall_ms);
+    if (execution->instructions) {
+      instructions.emplace_back(*execution->instructions);
+    }
+    if (execution->syscalls) {
+      syscalls.emplace_back(*execution->syscalls);
+    }
+  }
+
+  return Runs{exit_code,
+              pink::bench::Percentile(wall_ms, 0.5),
+              *std::min_element(wall_ms.begin(), wall_ms.end()),
+              Median(instructions),
+              Median(syscalls)};
+}
+
+auto ToJSON(const Runs &runs) -> llvm::json::Object {
+  llvm::json::Object object{
+      {"exit_code", runs.exit_code},
+      {"median_ms", runs.median_ms},
+      {"min_ms", runs.min_ms},
+  };
+  if (runs.instructions) {
+    object["instructions"] = static_cast<int64_t>(*runs.instructions);
+  }
+  if (runs.syscalls) {
+    object["syscalls"] = static_cast<int64_t>(*runs.syscalls);
+  }
+  return object;
+}
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  std::string kernel_directory = "bench/kernels";
+  std::size_t runs             = 5;
+  std::string pink             = "./pink";
+  std::string cc               = "clang";
+  std::string output_file;
+
+  // NOLINTBEGIN
+  static struct option long_options[] = {
+      {"kernels", required_argument, nullptr, 'k'},
+      {"runs", required_argument, nullptr, 'n'},
+      {"pink", required_argument, nullptr, 'p'},
+      {"cc", required_argument, nullptr, 'c'},
+      {"output", required_argument, nullptr, 'o'},
+      {nullptr, 0, nullptr, 0}};
+
+  int option = 0;
+  while ((option = getopt_long(argc,
+                               argv,
+                               "k:n:p:c:o:",
+                               long_options,
+                               nullptr)) != -1) {
+    switch (option) {
+    case 'k': {
+      kernel_directory = optarg;
+      break;
+    }
+    case 'n': {
+      runs = std::max<std::size_t>(std::stoul(optarg), 1);
+      break;
+    }
+    case 'p': {
+      pink = optarg;
+      break;
+    }
+    case 'c': {
+      cc = optarg;
+      break;
+    }
+    case 'o': {
+      output_file = optarg;
+      break;
+    }
+    default: {
+      std::cerr << "pink_kernels [-k <kernel directory>] [-n <runs>] "
+                   "[-p <pink executable>] [-c <c compiler>] "
+                   "[-o <output file>]\n";
+      return EXIT_FAILURE;
+    }
+    }
+  }
+  // NOLINTEND
+
+  std::vector<fs::path> kernels;
+  std::error_code       errc;
+  for (const auto &entry : fs::directory_iterator{kernel_directory, errc}) {
+    if (entry.path().extension() == ".p") {
+      kernels.emplace_back(entry.path());
+    }
+  }
+  if (errc || kernels.empty()) {
+    std::cerr << "No kernels within [" << kernel_directory << "]\n";
+    return EXIT_FAILURE;
+  }
+  std::sort(kernels.begin(), kernels.end());
+
+  auto directory = fs::temp_directory_path(errc) /
+                   ("pink_kernels" + std::to_string(getpid()));
+  if (errc || !fs::create_directories(directory, errc)) {
+    std::cerr << "Could not create [" << directory << "] " << errc.message()
+              << "\n";
+    return EXIT_FAILURE;
+  }
+
+  pink::bench::InstructionCounter counter;
+  if (!counter.IsAvailable()) {
+    std::cerr << "perf counters are unavailable, only timing\n";
+  }
+  pink::bench::SyscallCounter syscall_counter;
+  if (!syscall_counter.IsAvailable()) {
+    std::cerr << "the syscall tracepoint is unavailable, syscalls are not "
+                 "counted\n";
+  }
+
+  llvm::json::Array results;
+  bool              passed = true;
+  for (const auto &kernel : kernels) {
+    auto name      = kernel.stem().string();
+    auto reference = kernel;
+    reference.replace_extension(".c");
+    if (!fs::exists(reference)) {
+      std::cerr << "[" << name << "] has no reference [" << reference
+                << "]\n";
+      passed = false;
+      continue;
+    }
+
+    for (const auto &level : levels) {
+      std::string optimize{"-O"};
+      optimize += level;
+      auto pink_program = directory / (name + "_pink" + optimize);
+      auto c_program    = directory / (name + "_c" + optimize);
+
+      std::vector<std::string> pink_compile{pink,
+                                            optimize,
+                                            "-i",
+                                            kernel,
+                                            "-o",
+                                            pink_program};
+      std::vector<std::string> c_compile{cc,
+                                         optimize,
+                                         "-march=native",
+                                         "-o",
+                                         c_program,
+                                         reference};
+      if (!Compile(pink_compile) || !Compile(c_compile)) {
+        passed = false;
+        continue;
+      }
+
+      auto pink_runs = Run(pink_program, runs, counter, syscall_counter);
+      auto c_runs    = Run(c_program, runs, counter, syscall_counter);
+      if (!pink_runs || !c_runs) {
+        passed = false;
+        continue;
+      }
+
+      auto matches = pink_runs->exit_code == c_runs->exit_code;
+      if (!matches) {
+        std::cerr << "[" << name << "] " << optimize << " exited with ["
+                  << pink_runs->exit_code << "], the reference exited with ["
+                  << c_runs->exit_code << "]\n";
+        passed = false;
+      }
+
+      llvm::json::Object result{
+          {"kernel", name},
+          {"level", optimize},
+          {"pink", ToJSON(*pink_runs)},
+          {"c", ToJSON(*c_runs)},
+          {"ratio", pink_runs->median_ms / std::max(c_runs->median_ms, 1.0e-3)},
+      };
+
+      for (const auto &[mode, key] : bounds_checks) {
+        auto program = directory / (name + "_" + key + optimize);
+        std::vector<std::string> compile{pink,
+                                         optimize,
+                                         "--bounds-checks",
+                                         mode,
+                                         "-i",
+                                         kernel,
+                                         "-o",
+                                         program};
+        if (!Compile(compile)) {
+          passed = false;
+          continue;
+        }
+        auto mode_runs = Run(program, runs, counter, syscall_counter);
+        if (!mode_runs) {
+          passed = false;
+          continue;
+        }
+        if (mode_runs->exit_code != c_runs->exit_code) {
+          std::cerr << "[" << name << "] " << optimize
+                    << " with bounds checks [" << mode << "] exited with ["
+                    << mode_runs->exit_code << "], the reference exited with ["
+                    << c_runs->exit_code << "]\n";
+          matches = false;
+          passed  = false;
+        }
+        result[key] = ToJSON(*mode_runs);
+      }
+
+      result["matches"] = matches;
+      results.emplace_back(std::move(result));
+    }
+  }
+  fs::remove_all(directory, errc);
+
+  llvm::json::Value value{llvm::json::Object{
+      {"runs", static_cast<int64_t>(runs)},
+      {"kernels", std::move(results)},
+  }};
+  if (output_file.empty()) {
+    llvm::outs() << llvm::formatv("{0:2}", value) << "\n";
+  } else {
+    std::error_code      output_error;
+    llvm::raw_fd_ostream output{output_file, output_error};
+    if (output_error) {
+      std::cerr << "Could not open output file [" << output_file << "] "
+                << output_error.message() << "\n";
+      return EXIT_FAILURE;
+    }
+    output << llvm::formatv("{0:2}", value) << "\n";
+  }
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
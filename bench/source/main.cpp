@@ -0,0 +1,413 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/*
+  pink_bench measures the throughput of each phase of the
+  compiler separately, and prints the results as JSON.
+
+  pink_bench [-n <iterations>] [-s <synthetic functions>] [-S]
+             [-o <output file>]
+
+  with -S (--scaling) each parameter of the generated program
+  is doubled in turn, and the observed growth exponent of each
+  phase is reported instead.
+*/
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+#include "support/Benchmark.hpp"
+#include "support/Generator.hpp"
+#include "support/Programs.hpp"
+
+#include "aux/Environment.h"
+#include "front/Lexer.h"
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/TargetSelect.h"
+
+namespace {
+using pink::bench::Suite;
+using pink::bench::Timer;
+
+struct Level {
+  std::string_view        name;
+  llvm::OptimizationLevel level;
+};
+
+const std::array<Level, 6> all_levels{
+    Level{"O0", llvm::OptimizationLevel::O0},
+    Level{"O1", llvm::OptimizationLevel::O1},
+    Level{"O2", llvm::OptimizationLevel::O2},
+    Level{"O3", llvm::OptimizationLevel::O3},
+    Level{"Os", llvm::OptimizationLevel::Os},
+    Level{"Oz", llvm::OptimizationLevel::Oz},
+};
+
+// the scaling tests only look at the unoptimized and the
+// default pipeline, as every input is measured many times.
+const std::array<Level, 2> scaling_levels{
+    Level{"O0", llvm::OptimizationLevel::O0},
+    Level{"O2", llvm::OptimizationLevel::O2},
+};
+
+/*
+  each phase runs on a fresh CompilationUnit, which has been
+  taken through each of the prior phases outside of the
+  measurement.
+*/
+enum class Phase {
+  Parse,
+  Typecheck,
+  Codegen,
+  Analysis,
+};
+
+struct Pipeline {
+  std::istringstream           input;
+  pink::CompilationUnit        unit;
+  pink::CompilationUnit::Terms terms;
+
+  Pipeline(std::string_view source, llvm::OptimizationLevel level)
+      : input{std::string{source}},
+        unit{pink::CompilationUnit::CreateNativeCompilationUnit(
+            pink::CLIOptions{"bench.p", "bench", pink::CLIFlags{}, level},
+            &input)} {}
+
+  /**
+   * @brief runs each phase before the given phase
+   */
+  auto RunUntil(Phase phase, std::ostream &err) -> bool {
+    if (phase == Phase::Parse) {
+      return true;
+    }
+    if (!Parse(err)) {
+      return false;
+    }
+
+    if (phase == Phase::Typecheck) {
+      return true;
+    }
+    if (!Typecheck(err)) {
+      return false;
+    }
+
+    if (phase == Phase::Codegen) {
+      return true;
+    }
+    return Codegen(err);
+  }
+
+  auto Parse(std::ostream &err) -> bool {
+    auto result = unit.ParseTerms();
+    if (!result) {
+      unit.PrintErrorWithSourceText(err, result.GetSecond());
+      return false;
+    }
+    terms = std::move(result.GetFirst());
+    return true;
+  }
+
+  auto Typecheck(std::ostream &err) -> bool {
+    auto errors = unit.TypecheckTerms(terms);
+    if (errors) {
+      for (const auto &error : errors.value()) {
+        unit.PrintErrorWithSourceText(err, error);
+      }
+      return false;
+    }
+    return true;
+  }
+
+  auto Codegen(std::ostream &err) -> bool {
+    auto error = unit.CodegenTerms(terms);
+    if (error) {
+      unit.PrintErrorWithSourceText(err, error.value());
+      return false;
+    }
+    return true;
+  }
+
+  auto Analysis(std::ostream &err) -> bool {
+    return unit.DefaultAnalysis(err) == EXIT_SUCCESS;
+  }
+
+  auto EmitObject(std::ostream &err) -> bool {
+    llvm::SmallVector<char, 0> buffer;
+    return unit.EmitObjectBuffer(buffer, err) == EXIT_SUCCESS;
+  }
+};
+
+auto BenchmarkInput(Suite                &suite,
+                    std::string_view      input_name,
+                    std::string_view      source,
+                    llvm::ArrayRef<Level> levels,
+                    std::ostream         &err) -> bool {
+  auto bytes = source.size();
+
+  auto lex = [&](Timer &timer) {
+    pink::Lexer lexer{source};
+    std::size_t count = 0;
+    timer.Start();
+    while (lexer.lex() != pink::Token::End) {
+      ++count;
+    }
+    timer.Stop();
+    return count != 0;
+  };
+  if (!suite.Run("Lexer::lex", input_name, bytes, lex)) {
+    return false;
+  }
+
+  // measures the given phase, at -O0 when the phase does not
+  // depend upon the optimization level
+  auto phase = [&](Phase until, auto &&measure, llvm::OptimizationLevel level) {
+    return [&, until, measure, level](Timer &timer) {
+      Pipeline pipeline{source, level};
+      if (!pipeline.RunUntil(until, err)) {
+        return false;
+      }
+      timer.Start();
+      auto result = measure(pipeline);
+      timer.Stop();
+      return result;
+    };
+  };
+
+  auto parse     = [&](Pipeline &pipeline) { return pipeline.Parse(err); };
+  auto typecheck = [&](Pipeline &pipeline) { return pipeline.Typecheck(err); };
+  auto codegen   = [&](Pipeline &pipeline) { return pipeline.Codegen(err); };
+  auto analysis  = [&](Pipeline &pipeline) { return pipeline.Analysis(err); };
+  auto emit      = [&](Pipeline &pipeline) { return pipeline.EmitObject(err); };
+
+  auto O0 = llvm::OptimizationLevel::O0;
+  if (!suite.Run("Parser::Parse",
+                 input_name,
+                 bytes,
+                 phase(Phase::Parse, parse, O0)) ||
+      !suite.Run("TypecheckTerms",
+                 input_name,
+                 bytes,
+                 phase(Phase::Typecheck, typecheck, O0)) ||
+      !suite.Run("CodegenTerms",
+                 input_name,
+                 bytes,
+                 phase(Phase::Codegen, codegen, O0))) {
+    return false;
+  }
+
+  for (const auto &level : levels) {
+    std::string analysis_name{"DefaultAnalysis/"};
+    analysis_name += level.name;
+    if (!suite.Run(analysis_name,
+                   input_name,
+                   bytes,
+                   phase(Phase::Analysis, analysis, level.level))) {
+      return false;
+    }
+
+    // the object file is emitted after the module is optimized
+    std::string emit_name{"EmitObjectFile/"};
+    emit_name += level.name;
+    if (!suite.Run(emit_name,
+                   input_name,
+                   bytes,
+                   [&](Timer &timer) {
+                     Pipeline pipeline{source, level.level};
+                     if (!pipeline.RunUntil(Phase::Analysis, err) ||
+                         !pipeline.Analysis(err)) {
+                       return false;
+                     }
+                     timer.Start();
+                     auto result = pipeline.EmitObject(err);
+                     timer.Stop();
+                     return result;
+                   })) {
+      return false;
+    }
+  }
+  return true;
+}
+/*
+  runs the benchmarks over programs where a single parameter
+  of the shape is doubled each time, and reports the slope of
+  log(time) against log(parameter) for each phase. a slope near
+  1 is linear growth, near 2 is quadratic growth.
+*/
+auto Scaling(std::size_t                base_iterations,
+             const pink::bench::Shape &base,
+             std::ostream             &out,
+             std::ostream             &err) -> bool {
+  static constexpr std::size_t doublings = 3;
+
+  out << "{\n  \"iterations\": " << base_iterations
+      << ",\n  \"scaling\": [";
+  bool first_parameter = true;
+  for (const auto &parameter : pink::bench::Shape::parameters) {
+    std::vector<double>                        values;
+    std::map<std::string, std::vector<double>> medians;
+
+    auto shape = base;
+    for (std::size_t step = 0; step < doublings; ++step) {
+      auto &value = shape.*(parameter.member);
+      if (step != 0) {
+        value *= 2;
+      }
+      values.emplace_back(static_cast<double>(value));
+
+      Suite suite{base_iterations};
+      auto  program = pink::bench::GenerateProgram(shape);
+      if (!BenchmarkInput(suite,
+                          parameter.name,
+                          program,
+                          scaling_levels,
+                          err)) {
+        return false;
+      }
+      for (const auto &result : suite.GetResults()) {
+        medians[result.name].emplace_back(result.Median());
+      }
+    }
+
+    out << (first_parameter ? "\n" : ",\n");
+    first_parameter = false;
+    out << "    {\"parameter\": \"" << parameter.name << "\", \"values\": [";
+    for (std::size_t index = 0; index < values.size(); ++index) {
+      out << (index == 0 ? "" : ", ") << values[index];
+    }
+    out << "], \"phases\": [";
+
+    bool first_phase = true;
+    for (const auto &[name, times] : medians) {
+      // least squares slope of log2(time) over log2(value)
+      double mean_x = 0.0;
+      double mean_y = 0.0;
+      for (std::size_t index = 0; index < times.size(); ++index) {
+        mean_x += std::log2(values[index]);
+        mean_y += std::log2(std::max(times[index], 1.0));
+      }
+      mean_x /= static_cast<double>(times.size());
+      mean_y /= static_cast<double>(times.size());
+
+      double covariance = 0.0;
+      double variance   = 0.0;
+      for (std::size_t index = 0; index < times.size(); ++index) {
+        auto delta_x  = std::log2(values[index]) - mean_x;
+        auto delta_y  = std::log2(std::max(times[index], 1.0)) - mean_y;
+        covariance   += delta_x * delta_y;
+        variance     += delta_x * delta_x;
+      }
+      auto exponent = variance > 0.0 ? covariance / variance : 0.0;
+
+      out << (first_phase ? "\n" : ",\n");
+      first_phase = false;
+      out << "      {\"name\": \"" << name << "\", \"median_ns\": [";
+      for (std::size_t index = 0; index < times.size(); ++index) {
+        out << (index == 0 ? "" : ", ") << times[index];
+      }
+      out << "], \"exponent\": " << exponent << "}";
+    }
+    out << "\n    ]}";
+  }
+  out << "\n  ]\n}\n";
+  return true;
+}
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  llvm::InitLLVM llvm{argc, argv};
+  llvm::InitializeNativeTarget();
+  llvm::InitializeNativeTargetAsmPrinter();
+  llvm::InitializeNativeTargetAsmParser();
+
+  std::size_t        iterations = 10;
+  bool               scaling    = false;
+  pink::bench::Shape shape;
+  std::string        output_file;
+
+  // NOLINTBEGIN
+  static struct option long_options[] = {
+      {"iterations", required_argument, nullptr, 'n'},
+      {"synthetic-functions", required_argument, nullptr, 's'},
+      {"scaling", no_argument, nullptr, 'S'},
+      {"output", required_argument, nullptr, 'o'},
+      {nullptr, 0, nullptr, 0}};
+
+  int option = 0;
+  while ((option = getopt_long(argc, argv, "n:s:So:", long_options, nullptr)) !=
+         -1) {
+    switch (option) {
+    case 'n': {
+      iterations = std::stoul(optarg);
+      break;
+    }
+    case 's': {
+      shape.functions = std::max<std::size_t>(std::stoul(optarg), 1);
+      break;
+    }
+    case 'S': {
+      scaling = true;
+      break;
+    }
+    case 'o': {
+      output_file = optarg;
+      break;
+    }
+    default: {
+      std::cerr << "pink_bench [-n <iterations>] [-s <synthetic functions>] "
+                   "[-S] [-o <output file>]\n";
+      return EXIT_FAILURE;
+    }
+    }
+  }
+  // NOLINTEND
+
+  std::ofstream output;
+  if (!output_file.empty()) {
+    output.open(output_file);
+    if (!output.is_open()) {
+      std::cerr << "Could not open output file [" << output_file << "]\n";
+      return EXIT_FAILURE;
+    }
+  }
+  std::ostream &out = output_file.empty() ? std::cout : output;
+
+  if (scaling) {
+    return Scaling(iterations, shape, out, std::cerr) ? EXIT_SUCCESS
+                                                      : EXIT_FAILURE;
+  }
+
+  Suite suite{iterations};
+  auto  synthetic = pink::bench::GenerateProgram(shape);
+  if (!BenchmarkInput(suite,
+                      "representative",
+                      pink::bench::representative_program,
+                      all_levels,
+                      std::cerr) ||
+      !BenchmarkInput(suite, "synthetic", synthetic, all_levels, std::cerr)) {
+    return EXIT_FAILURE;
+  }
+
+  suite.PrintJSON(out);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,425 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/*
+  pink_perf compiles a fixed corpus with the pink executable
+  a number of times, and records the wall time, peak resident
+  set size, object file size and llvm IR size of each file in
+  the corpus.
+
+  pink_perf [-n <iterations>] [-p <pink executable>]
+            [-b <baseline>] [-t <tolerance>] [-o <output file>]
+
+  given a baseline, (a previous output of pink_perf) each
+  file is compared against it, and pink_perf exits with
+  EXIT_FAILURE if the median wall time, the peak rss, the
+  object size or the IR size of any file grew by more than
+  the tolerance.
+  when the baseline does not exist yet, the measurements are
+  recorded as the baseline instead, as the measurements are
+  only comparable on the machine which made them.
+*/
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "support/Benchmark.hpp"
+#include "support/Generator.hpp"
+#include "support/LanguageTerms.hpp"
+#include "support/Process.hpp"
+#include "support/Programs.hpp"
+
+#include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+struct Source {
+  std::string              name;
+  std::string              text;
+  std::vector<std::string> flags;
+};
+
+/*
+  the terms of LanguageTerms.hpp which are closed functions,
+  such that they can be compiled without any surrounding
+  definitions. none of them are reachable from main, so they
+  are compiled with --check-all.
+*/
+auto LanguageTermsProgram() -> std::string {
+  const std::array terms{
+      term_acg, term_ach, term_aci, term_ack, term_acl, term_aco, term_acp,
+      term_acq, term_acr, term_acs, term_act, term_acu, term_acv, term_acw,
+      term_acx, term_acy, term_acz, term_ada, term_adb, term_adc, term_adf,
+      term_adg, term_adh, term_adi, term_adj, term_adk, term_aea, term_aeb,
+      term_aef, term_aeg, term_aem, term_aen, term_aeq, term_aer,
+  };
+
+  std::string program;
+  for (const auto *term : terms) {
+    program += term;
+    program += "\n";
+  }
+  program += "fn main() { 0; }\n";
+  return program;
+}
+
+/*
+  copies of an [Integer; 4096], from a constant literal, by
+  binding, by assignment and as an argument. each copy is a
+  single memcpy, so the IR and the compile time should not
+  grow with the size of the array.
+*/
+auto LargeAggregateProgram() -> std::string {
+  static constexpr std::size_t size = 4096;
+
+  std::string literal = "[";
+  for (std::size_t index = 0; index < size; ++index) {
+    if (index != 0) {
+      literal += ", ";
+    }
+    literal += std::to_string(index);
+  }
+  literal += "]";
+
+  std::string program = "fn last(a: [Integer; 4096]) { a[4095]; }\n";
+  program += "fn main() {\n";
+  program += "  a := " + literal + ";\n";
+  program += "  b := a;\n";
+  program += "  b[0] = 7;\n";
+  program += "  a = b;\n";
+  program += "  (last(a) + a[0]) % 256;\n";
+  program += "}\n";
+  return program;
+}
+
+auto Corpus() -> std::vector<Source> {
+  pink::bench::Shape large;
+  large.functions = 1000;
+
+  return {
+      {"language_terms", LanguageTermsProgram(), {"--check-all"}},
+      {"representative", std::string{pink::bench::representative_program}, {}},
+      {"generated", pink::bench::GenerateProgram(pink::bench::Shape{}), {}},
+      {"generated_large", pink::bench::GenerateProgram(large), {}},
+      {"large_aggregates", LargeAggregateProgram(), {}},
+  };
+}
+
+auto Measure(const std::string &pink,
+             const Source      &source,
+             std::size_t        iterations,
+             const fs::path    &directory)
+    -> std::optional<llvm::json::Object> {
+  auto input  = directory / (source.name + ".p");
+  auto object = directory / (source.name + ".o");
+  auto ir     = directory / (source.name + ".ll");
+  {
+    std::ofstream file{input};
+    file << source.text;
+    if (!file) {
+      std::cerr << "Could not write [" << input << "]\n";
+      return {};
+    }
+  }
+
+  std::vector<std::string> arguments{pink, "-i", input, "-c", "-o", object};
+  arguments.insert(arguments.end(), source.flags.begin(), source.flags.end());
+
+  std::vector<double> wall_ms;
+  long                peak_rss_kb = 0;
+  for (std::size_t iteration = 0; iteration < iterations; ++iteration) {
+    auto execution = pink::bench::Execute(arguments);
+    if (!execution || !execution->exited ||
+        (execution->exit_code != EXIT_SUCCESS)) {
+      std::cerr << "Could not compile [" << source.name << "]\n";
+      return {};
+    }
+    wall_ms.emplace_back(execution->wall_ms);
+    peak_rss_kb = std::max(peak_rss_kb, execution->peak_rss_kb);
+  }
+
+  // the IR is emitted once more, as it's size is the same each time
+  std::vector<std::string> emit_ir{pink, "-i", input, "--emit-llvm", "-o", ir};
+  emit_ir.insert(emit_ir.end(), source.flags.begin(), source.flags.end());
+  auto emission = pink::bench::Execute(emit_ir);
+  if (!emission || !emission->exited ||
+      (emission->exit_code != EXIT_SUCCESS)) {
+    std::cerr << "Could not emit the IR of [" << source.name << "]\n";
+    return {};
+  }
+
+  std::error_code errc;
+  auto            object_bytes = fs::file_size(object, errc);
+  if (errc) {
+    std::cerr << "Could not find [" << object << "] " << errc.message()
+              << "\n";
+    return {};
+  }
+  auto ir_bytes = fs::file_size(ir, errc);
+  if (errc) {
+    std::cerr << "Could not find [" << ir << "] " << errc.message() << "\n";
+    return {};
+  }
+
+  return llvm::json::Object{
+      {"name", source.name},
+      {"source_bytes", static_cast<int64_t>(source.text.size())},
+      {"median_ms", pink::bench::Percentile(wall_ms, 0.5)},
+      {"p90_ms", pink::bench::Percentile(wall_ms, 0.9)},
+      {"min_ms", *std::min_element(wall_ms.begin(), wall_ms.end())},
+      {"peak_rss_kb", static_cast<int64_t>(peak_rss_kb)},
+      {"object_bytes", static_cast<int64_t>(object_bytes)},
+      {"ir_bytes", static_cast<int64_t>(ir_bytes)},
+  };
+}
+
+auto FindFile(const llvm::json::Array *files, llvm::StringRef name)
+    -> const llvm::json::Object * {
+  if (files == nullptr) {
+    return nullptr;
+  }
+  for (const auto &file : *files) {
+    const auto *object = file.getAsObject();
+    if ((object != nullptr) && (object->getString("name") == name)) {
+      return object;
+    }
+  }
+  return nullptr;
+}
+
+/*
+  reports each measurement which grew by more than the tolerance.
+  files missing from the baseline are not regressions.
+*/
+auto Compare(const llvm::json::Array  &current,
+             const llvm::json::Object &baseline,
+             double                    tolerance) -> bool {
+  static constexpr std::array metrics{"median_ms",
+                                      "peak_rss_kb",
+                                      "object_bytes",
+                                      "ir_bytes"};
+  const auto *baseline_files = baseline.getArray("files");
+
+  bool passed = true;
+  for (const auto &file : current) {
+    const auto *now  = file.getAsObject();
+    auto        name = now->getString("name");
+    assert(name);
+    const auto *then = FindFile(baseline_files, *name);
+    if (then == nullptr) {
+      std::cerr << "[" << name->str() << "] is not in the baseline\n";
+      continue;
+    }
+
+    for (const auto *metric : metrics) {
+      auto now_value  = now->getNumber(metric);
+      auto then_value = then->getNumber(metric);
+      if (!now_value || !then_value) {
+        continue;
+      }
+      if (*now_value > *then_value * (1.0 + tolerance)) {
+        std::cerr << "regression [" << name->str() << "] " << metric << " ["
+                  << *then_value << "] -> [" << *now_value << "]\n";
+        passed = false;
+      }
+    }
+  }
+  return passed;
+}
+
+/*
+  parses the whole of text as a number, unlike std::stod and
+  std::stoul, which throw on bad input and accept trailing text.
+*/
+template <class T>
+auto ParseNumber(std::string_view text) -> std::optional<T> {
+  T    value{};
+  auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+  if ((result.ec != std::errc{}) || (result.ptr != text.data() + text.size())) {
+    return {};
+  }
+  return value;
+}
+
+auto WriteResults(const llvm::json::Value &results,
+                  const std::string       &filename) -> bool {
+  if (filename.empty()) {
+    llvm::outs() << llvm::formatv("{0:2}", results) << "\n";
+    return true;
+  }
+  std::error_code      error;
+  llvm::raw_fd_ostream output{filename, error};
+  if (error) {
+    std::cerr << "Could not open output file [" << filename << "] "
+              << error.message() << "\n";
+    return false;
+  }
+  output << llvm::formatv("{0:2}", results) << "\n";
+  return true;
+}
+
+auto ReadBaseline(const std::string &filename)
+    -> std::optional<llvm::json::Object> {
+  std::ifstream file{filename};
+  if (!file.is_open()) {
+    std::cerr << "Could not open baseline [" << filename << "]\n";
+    return {};
+  }
+  std::stringstream text;
+  text << file.rdbuf();
+
+  auto parsed = llvm::json::parse(text.str());
+  if (!parsed) {
+    std::cerr << "Could not parse baseline [" << filename << "] "
+              << llvm::toString(parsed.takeError()) << "\n";
+    return {};
+  }
+  auto *object = parsed->getAsObject();
+  if (object == nullptr) {
+    std::cerr << "baseline [" << filename << "] is not a JSON object\n";
+    return {};
+  }
+  return std::move(*object);
+}
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  std::size_t iterations = 5;
+  std::string pink       = "./pink";
+  std::string baseline_file;
+  double      tolerance = 0.10;
+  std::string output_file;
+
+  // NOLINTBEGIN
+  static struct option long_options[] = {
+      {"iterations", required_argument, nullptr, 'n'},
+      {"pink", required_argument, nullptr, 'p'},
+      {"baseline", required_argument, nullptr, 'b'},
+      {"tolerance", required_argument, nullptr, 't'},
+      {"output", required_argument, nullptr, 'o'},
+      {nullptr, 0, nullptr, 0}};
+
+  int option = 0;
+  while ((option = getopt_long(argc,
+                               argv,
+                               "n:p:b:t:o:",
+                               long_options,
+                               nullptr)) != -1) {
+    switch (option) {
+    case 'n': {
+      auto count = ParseNumber<std::size_t>(optarg);
+      if (!count) {
+        std::cerr << "iterations must be a number, saw [" << optarg << "]\n";
+        return EXIT_FAILURE;
+      }
+      iterations = std::max<std::size_t>(*count, 1);
+      break;
+    }
+    case 'p': {
+      pink = optarg;
+      break;
+    }
+    case 'b': {
+      baseline_file = optarg;
+      break;
+    }
+    case 't': {
+      auto fraction = ParseNumber<double>(optarg);
+      if (!fraction || (*fraction < 0.0)) {
+        std::cerr << "tolerance must be a non-negative number, saw [" << optarg
+                  << "]\n";
+        return EXIT_FAILURE;
+      }
+      tolerance = *fraction;
+      break;
+    }
+    case 'o': {
+      output_file = optarg;
+      break;
+    }
+    default: {
+      std::cerr << "pink_perf [-n <iterations>] [-p <pink executable>] "
+                   "[-b <baseline>] [-t <tolerance>] [-o <output file>]\n";
+      return EXIT_FAILURE;
+    }
+    }
+  }
+  // NOLINTEND
+
+  std::error_code errc;
+  auto directory = fs::temp_directory_path(errc) /
+                   ("pink_perf" + std::to_string(getpid()));
+  if (errc || !fs::create_directories(directory, errc)) {
+    std::cerr << "Could not create [" << directory << "] " << errc.message()
+              << "\n";
+    return EXIT_FAILURE;
+  }
+
+  llvm::json::Array files;
+  bool              compiled = true;
+  for (const auto &source : Corpus()) {
+    auto measurement = Measure(pink, source, iterations, directory);
+    if (!measurement) {
+      compiled = false;
+      break;
+    }
+    files.emplace_back(std::move(*measurement));
+  }
+  fs::remove_all(directory, errc);
+  if (!compiled) {
+    return EXIT_FAILURE;
+  }
+
+  llvm::json::Object results{
+      {"iterations", static_cast<int64_t>(iterations)},
+      {"files", llvm::json::Array{files}},
+  };
+
+  llvm::json::Value value{std::move(results)};
+  if (!WriteResults(value, output_file)) {
+    return EXIT_FAILURE;
+  }
+
+  if (baseline_file.empty()) {
+    return EXIT_SUCCESS;
+  }
+
+  if (!fs::exists(baseline_file, errc)) {
+    std::cerr << "No baseline at [" << baseline_file
+              << "], recording these measurements as the baseline\n";
+    return WriteResults(value, baseline_file) ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  auto baseline = ReadBaseline(baseline_file);
+  if (!baseline) {
+    return EXIT_FAILURE;
+  }
+  return Compare(files, *baseline, tolerance) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
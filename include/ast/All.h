@@ -25,14 +25,19 @@
 #include "ast/Binop.h"
 #include "ast/Block.h"
 #include "ast/Boolean.h"
+#include "ast/Cast.h"
 #include "ast/Conditional.h"
 #include "ast/Dot.h"
+#include "ast/Float.h"
+#include "ast/For.h"
 #include "ast/Function.h"
 #include "ast/Integer.h"
+#include "ast/Intrinsic.h"
 #include "ast/Nil.h"
 #include "ast/Subscript.h"
 #include "ast/Tuple.h"
 #include "ast/Unop.h"
 #include "ast/ValueOf.h"
 #include "ast/Variable.h"
+#include "ast/Vector.h"
 #include "ast/While.h"
\ No newline at end of file
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "ast/Ast.h"
+#include "ast/Integer.h"
 
 #include "llvm/IR/Value.h"
 
@@ -63,20 +64,29 @@ namespace pink {
 
 /**
  * @brief Array represents a sequence of known length of a single known type.
+ *
+ * an Array composed entirely of integer literals is held as a packed
+ * buffer of values instead of a sequence of Integer nodes, in which
+ * case the Elements are empty.
  */
 class Array : public Ast {
 public:
   using Elements       = std::vector<Ast::Pointer>;
+  using Packed         = std::vector<Integer::Value>;
   using iterator       = Elements::iterator;
   using const_iterator = Elements::const_iterator;
 
 private:
   Elements elements;
+  Packed   packed;
 
 public:
   Array(Location location, Elements elements) noexcept
       : Ast(Ast::Kind::Array, location),
         elements(std::move(elements)) {}
+  Array(Location location, Packed packed) noexcept
+      : Ast(Ast::Kind::Array, location),
+        packed(std::move(packed)) {}
   ~Array() noexcept override                             = default;
   Array(const Array &other) noexcept                     = delete;
   Array(Array &&other) noexcept                          = default;
@@ -87,8 +97,18 @@ public:
     return std::make_unique<Array>(location, std::move(elements));
   }
 
+  static auto Create(Location location, Packed packed) noexcept {
+    return std::make_unique<Array>(location, std::move(packed));
+  }
+
   [[nodiscard]] auto Size() const noexcept -> std::size_t {
-    return elements.size();
+    return IsPacked() ? packed.size() : elements.size();
+  }
+  [[nodiscard]] auto IsPacked() const noexcept -> bool {
+    return !packed.empty();
+  }
+  [[nodiscard]] auto GetPacked() const noexcept -> const Packed & {
+    return packed;
   }
   [[nodiscard]] auto GetElements() noexcept -> Elements & { return elements; }
   [[nodiscard]] auto GetElements() const noexcept -> const Elements & {
@@ -21,6 +21,8 @@
  * @version 0.1
  */
 #pragma once
+#include <utility> // std::pair
+
 #include "ast/Ast.h"
 
 namespace pink {
@@ -55,6 +57,16 @@ public:
   auto GetRight() noexcept -> Ast::Pointer & { return right; }
   auto GetRight() const noexcept -> const Ast::Pointer & { return right; }
 
+  /**
+   * @brief the vector and lane of the left, when the left is a
+   * lane of a vector (v.n or v[n]), otherwise a pair of nullptr.
+   *
+   * #NOTE: this depends on the type of the vector, so it may
+   * only be called after a successful Typecheck
+   */
+  [[nodiscard]] auto GetLane() const noexcept
+      -> std::pair<const Ast *, const Ast *>;
+
   static auto classof(const Ast *ast) noexcept -> bool {
     return Ast::Kind::Assignment == ast->GetKind();
   }
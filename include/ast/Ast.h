@@ -98,19 +98,24 @@ public:
     Bind,
     Binop,
     Block,
+    Cast,
     IfThenElse,
     Dot,
+    For,
     Function,
+    Intrinsic,
     Subscript,
     Unop,
     Variable,
     ValueOf,
+    Vector,
     While,
     LastExpression,
 
     Nil,
     Boolean,
     Integer,
+    Float,
     Array,
     Tuple,
     LastValue,
@@ -0,0 +1,81 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+/**
+ * @file Cast.h
+ * @brief Header for class Cast
+ * @version 0.1
+ */
+#pragma once
+#include "ast/Ast.h"
+
+namespace pink {
+/**
+ * @brief Represents an explicit conversion between numeric types
+ *
+ * \verbatim
+   u8(x), i32(x), Integer(x), Float32(x), Float64(x)
+ * \endverbatim
+ *
+ * a value is sign extended if it's own type is signed, and zero
+ * extended otherwise, a value is truncated to a narrower type.
+ * a float converted to an integer is rounded toward zero.
+ */
+class Cast : public Ast {
+private:
+  Type::Pointer target;
+  Ast::Pointer  right;
+
+public:
+  Cast(Location location, Type::Pointer target, Ast::Pointer right) noexcept
+      : Ast(Ast::Kind::Cast, location),
+        target(target),
+        right(std::move(right)) {}
+  ~Cast() noexcept override                            = default;
+  Cast(const Cast &other) noexcept                     = delete;
+  Cast(Cast &&other) noexcept                          = default;
+  auto operator=(const Cast &other) noexcept -> Cast & = delete;
+  auto operator=(Cast &&other) noexcept -> Cast      & = default;
+
+  static auto
+  Create(Location location, Type::Pointer target, Ast::Pointer right) noexcept {
+    return std::make_unique<Cast>(location, target, std::move(right));
+  }
+
+  [[nodiscard]] auto GetTarget() const noexcept -> Type::Pointer {
+    return target;
+  }
+  [[nodiscard]] auto GetRight() noexcept -> Ast::Pointer & { return right; }
+  [[nodiscard]] auto GetRight() const noexcept -> const Ast::Pointer & {
+    return right;
+  }
+
+  static auto classof(const Ast *ast) noexcept -> bool {
+    return Ast::Kind::Cast == ast->GetKind();
+  }
+
+  auto Typecheck(CompilationUnit &unit) const noexcept
+      -> Outcome<Type::Pointer> override;
+  auto Codegen(CompilationUnit &unit) const noexcept
+      -> Outcome<llvm::Value *> override;
+  void Print(std::ostream &stream) const noexcept override;
+
+  void Accept(AstVisitor *visitor) noexcept override { visitor->Visit(this); }
+  void Accept(ConstAstVisitor *visitor) const noexcept override {
+    visitor->Visit(this);
+  }
+};
+} // namespace pink
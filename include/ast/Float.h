@@ -0,0 +1,75 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/**
+ * @file Float.h
+ * @brief Header for class Float
+ * @version 0.1
+ */
+#pragma once
+
+#include "ast/Ast.h"
+
+namespace pink {
+/**
+ * @brief Represents a floating point value within an expression
+ *
+ * a literal such as 1.5 always has the type Float64, a Float32
+ * is constructed by conversion, as in Float32(1.5).
+ */
+class Float : public Ast {
+public:
+  using Value = double;
+
+private:
+  /**
+   * @brief holds the floating point value being represented.
+   */
+  Value value;
+
+public:
+  Float(Location location, Value value) noexcept
+      : Ast(Ast::Kind::Float, location),
+        value(value) {}
+  ~Float() noexcept override                             = default;
+  Float(const Float &other) noexcept                     = delete;
+  Float(Float &&other) noexcept                          = default;
+  auto operator=(const Float &other) noexcept -> Float & = delete;
+  auto operator=(Float &&other) noexcept -> Float      & = default;
+
+  static auto Create(Location location, Value value) noexcept {
+    return std::make_unique<Float>(location, value);
+  }
+
+  auto GetValue() const noexcept -> Value { return value; }
+
+  static auto classof(const Ast *ast) -> bool {
+    return Ast::Kind::Float == ast->GetKind();
+  }
+
+  auto Typecheck(CompilationUnit &unit) const noexcept
+      -> Outcome<Type::Pointer> override;
+  auto Codegen(CompilationUnit &unit) const noexcept
+      -> Outcome<llvm::Value *> override;
+  void Print(std::ostream &stream) const noexcept override;
+
+  void Accept(AstVisitor *visitor) noexcept override { visitor->Visit(this); }
+  void Accept(ConstAstVisitor *visitor) const noexcept override {
+    visitor->Visit(this);
+  }
+};
+} // namespace pink
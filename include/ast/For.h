@@ -0,0 +1,113 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/**
+ * @file For.h
+ * @brief Header for class For
+ * @version 0.1
+ */
+#pragma once
+
+#include "ast/Ast.h"
+
+#include "aux/StringInterner.h"
+
+namespace pink {
+/**
+ * @brief Represents an instance of a For loop
+ *
+ * a For loop either counts over an integer range,
+ * (for i in first .. last do {...}), or walks the
+ * elements of an array or slice, (for x in sequence do {...}).
+ * in the second case [last] is nullptr and [first] is the sequence.
+ *
+ * the optional hints are the unroll count and vectorization
+ * width requested for the loop, zero meaning no request.
+ */
+class For : public Ast {
+public:
+  struct Hints {
+    std::size_t unroll    = 0;
+    std::size_t vectorize = 0;
+  };
+
+private:
+  InternedString symbol;
+  Ast::Pointer   first;
+  Ast::Pointer   last;
+  Ast::Pointer   body;
+  Hints          hints;
+
+public:
+  For(Location       location,
+      InternedString symbol,
+      Ast::Pointer   first,
+      Ast::Pointer   last,
+      Ast::Pointer   body,
+      Hints          hints) noexcept
+      : Ast(Ast::Kind::For, location),
+        symbol(symbol),
+        first(std::move(first)),
+        last(std::move(last)),
+        body(std::move(body)),
+        hints(hints) {}
+  ~For() noexcept override                           = default;
+  For(const For &other) noexcept                     = delete;
+  For(For &&other) noexcept                          = default;
+  auto operator=(const For &other) noexcept -> For & = delete;
+  auto operator=(For &&other) noexcept -> For      & = default;
+
+  static auto Create(Location       location,
+                     InternedString symbol,
+                     Ast::Pointer   first,
+                     Ast::Pointer   last,
+                     Ast::Pointer   body,
+                     Hints          hints) noexcept {
+    return std::make_unique<For>(location,
+                                 symbol,
+                                 std::move(first),
+                                 std::move(last),
+                                 std::move(body),
+                                 hints);
+  }
+
+  auto GetSymbol() const noexcept -> InternedString { return symbol; }
+  auto IsRange() const noexcept -> bool { return last != nullptr; }
+  auto GetFirst() noexcept -> Ast::Pointer & { return first; }
+  auto GetFirst() const noexcept -> const Ast::Pointer & { return first; }
+  auto GetLast() noexcept -> Ast::Pointer & { return last; }
+  auto GetLast() const noexcept -> const Ast::Pointer & { return last; }
+  auto GetBody() noexcept -> Ast::Pointer & { return body; }
+  auto GetBody() const noexcept -> const Ast::Pointer & { return body; }
+  auto GetHints() const noexcept -> Hints { return hints; }
+
+  static auto classof(const Ast *ast) noexcept -> bool {
+    return Ast::Kind::For == ast->GetKind();
+  }
+
+  auto Typecheck(CompilationUnit &unit) const noexcept
+      -> Outcome<Type::Pointer> override;
+  auto Codegen(CompilationUnit &unit) const noexcept
+      -> Outcome<llvm::Value *> override;
+  void Print(std::ostream &stream) const noexcept override;
+
+  void Accept(AstVisitor *visitor) noexcept override { visitor->Visit(this); }
+  void Accept(ConstAstVisitor *visitor) const noexcept override {
+    visitor->Visit(this);
+  }
+};
+} // namespace pink
@@ -0,0 +1,145 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+/**
+ * @file Intrinsic.h
+ * @brief Header for class Intrinsic
+ * @version 0.1
+ */
+#pragma once
+#include <string_view>
+#include <vector>
+
+#include "ast/Ast.h"
+
+namespace pink {
+
+/**
+ * @brief Intrinsic represents a call of one of the builtin
+ * operations provided by the runtime.
+ *
+ * \verbatim
+   arena_alloc(T, n) -- n zeroed elements of type T from the arena
+   arena_reset()     -- release every arena allocation at once
+   pool_alloc(T, n)  -- n zeroed elements of type T from the pool
+   pool_free(s)      -- return the slice s to the pool
+   mem_copy(d, s)    -- copy the elements of s into d
+   mem_move(d, s)    -- copy the elements of s into d, which may overlap s
+   mem_fill(d, x)    -- store x into each element of d
+   mem_compare(a, b) -- true if a and b hold the same elements
+   print(s)          -- write the bytes of s to stdout
+ * \endverbatim
+ *
+ * allocations are slices, so every access through them is
+ * bounds checked like any other slice. the memory operations
+ * take arrays or slices, and check their bounds once rather
+ * than once per element.
+ */
+class Intrinsic : public Ast {
+public:
+  enum class Op {
+    ArenaAlloc,
+    ArenaReset,
+    PoolAlloc,
+    PoolFree,
+    MemCopy,
+    MemMove,
+    MemFill,
+    MemCompare,
+    Print,
+  };
+
+  using Arguments      = std::vector<Ast::Pointer>;
+  using iterator       = Arguments::iterator;
+  using const_iterator = Arguments::const_iterator;
+
+private:
+  Op            op;
+  Type::Pointer type_argument;
+  Arguments     arguments;
+
+public:
+  Intrinsic(Location      location,
+            Op            op,
+            Type::Pointer type_argument,
+            Arguments     arguments) noexcept
+      : Ast(Ast::Kind::Intrinsic, location),
+        op(op),
+        type_argument(type_argument),
+        arguments(std::move(arguments)) {}
+  ~Intrinsic() noexcept override                                 = default;
+  Intrinsic(const Intrinsic &other) noexcept                     = delete;
+  Intrinsic(Intrinsic &&other) noexcept                          = default;
+  auto operator=(const Intrinsic &other) noexcept -> Intrinsic & = delete;
+  auto operator=(Intrinsic &&other) noexcept -> Intrinsic      & = default;
+
+  static auto Create(Location      location,
+                     Op            op,
+                     Type::Pointer type_argument,
+                     Arguments     arguments) noexcept {
+    return std::make_unique<Intrinsic>(location,
+                                       op,
+                                       type_argument,
+                                       std::move(arguments));
+  }
+
+  /**
+   * @brief the Op named by the given text, if there is one
+   */
+  static auto Lookup(std::string_view name) noexcept -> std::optional<Op>;
+  static auto ToString(Op op) noexcept -> std::string_view;
+  /**
+   * @brief true if the first argument of the Op is a type
+   */
+  static auto TakesType(Op op) noexcept -> bool;
+
+  [[nodiscard]] auto GetOp() const noexcept -> Op { return op; }
+  // #NOTE: the type argument is nullptr when the Op takes no type
+  [[nodiscard]] auto GetTypeArgument() const noexcept -> Type::Pointer {
+    return type_argument;
+  }
+  [[nodiscard]] auto GetArguments() noexcept -> Arguments & {
+    return arguments;
+  }
+  [[nodiscard]] auto GetArguments() const noexcept -> const Arguments & {
+    return arguments;
+  }
+
+  [[nodiscard]] auto begin() noexcept -> iterator { return arguments.begin(); }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return arguments.begin();
+  }
+  [[nodiscard]] auto end() noexcept -> iterator { return arguments.end(); }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return arguments.end();
+  }
+
+  static auto classof(const Ast *ast) noexcept -> bool {
+    return Ast::Kind::Intrinsic == ast->GetKind();
+  }
+
+  auto Typecheck(CompilationUnit &unit) const noexcept
+      -> Outcome<Type::Pointer> override;
+  auto Codegen(CompilationUnit &unit) const noexcept
+      -> Outcome<llvm::Value *> override;
+  void Print(std::ostream &stream) const noexcept override;
+
+  void Accept(AstVisitor *visitor) noexcept override { visitor->Visit(this); }
+  void Accept(ConstAstVisitor *visitor) const noexcept override {
+    visitor->Visit(this);
+  }
+};
+} // namespace pink
@@ -0,0 +1,111 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+/**
+ * @file Vector.h
+ * @brief Header for class Vector
+ * @version 0.1
+ */
+#pragma once
+#include <vector>
+
+#include "ast/Ast.h"
+
+#include "type/VectorType.h"
+
+namespace pink {
+
+/**
+ * @brief Vector constructs a value of some VectorType.
+ *
+ * \verbatim
+   Vector<T; N>(a, b, ...) -- one argument per lane
+   Vector<T; N>(a)         -- the same argument in every lane
+   Vector<T; N>(xs, i)     -- the lanes xs[i] through xs[i + N - 1]
+ * \endverbatim
+ *
+ * the last form reads consecutive elements of an array or a slice,
+ * and when it appears on the left of an assignment it writes them.
+ */
+class Vector : public Ast {
+public:
+  using Arguments      = std::vector<Ast::Pointer>;
+  using iterator       = Arguments::iterator;
+  using const_iterator = Arguments::const_iterator;
+
+private:
+  const VectorType *vector_type;
+  Arguments         arguments;
+
+public:
+  Vector(Location          location,
+         const VectorType *vector_type,
+         Arguments         arguments) noexcept
+      : Ast(Ast::Kind::Vector, location),
+        vector_type(vector_type),
+        arguments(std::move(arguments)) {}
+  ~Vector() noexcept override                              = default;
+  Vector(const Vector &other) noexcept                     = delete;
+  Vector(Vector &&other) noexcept                          = default;
+  auto operator=(const Vector &other) noexcept -> Vector & = delete;
+  auto operator=(Vector &&other) noexcept -> Vector      & = default;
+
+  static auto Create(Location          location,
+                     const VectorType *vector_type,
+                     Arguments         arguments) noexcept {
+    return std::make_unique<Vector>(location,
+                                    vector_type,
+                                    std::move(arguments));
+  }
+
+  [[nodiscard]] auto GetVectorType() const noexcept -> const VectorType * {
+    return vector_type;
+  }
+  // #NOTE: IsLoad depends on the types of the arguments,
+  // so it may only be called after a successful Typecheck
+  [[nodiscard]] auto IsLoad() const noexcept -> bool;
+  [[nodiscard]] auto GetArguments() noexcept -> Arguments & {
+    return arguments;
+  }
+  [[nodiscard]] auto GetArguments() const noexcept -> const Arguments & {
+    return arguments;
+  }
+
+  [[nodiscard]] auto begin() noexcept -> iterator { return arguments.begin(); }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return arguments.begin();
+  }
+  [[nodiscard]] auto end() noexcept -> iterator { return arguments.end(); }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return arguments.end();
+  }
+
+  static auto classof(const Ast *ast) noexcept -> bool {
+    return Ast::Kind::Vector == ast->GetKind();
+  }
+
+  auto Typecheck(CompilationUnit &unit) const noexcept
+      -> Outcome<Type::Pointer> override;
+  auto Codegen(CompilationUnit &unit) const noexcept
+      -> Outcome<llvm::Value *> override;
+  void Print(std::ostream &stream) const noexcept override;
+
+  void Accept(AstVisitor *visitor) noexcept override { visitor->Visit(this); }
+  void Accept(ConstAstVisitor *visitor) const noexcept override {
+    visitor->Visit(this);
+  }
+};
+} // namespace pink
@@ -28,16 +28,21 @@ class Bind;
 class Binop;
 class Block;
 class Boolean;
+class Cast;
 class IfThenElse;
 class Dot;
+class Float;
+class For;
 class Function;
 class Integer;
+class Intrinsic;
 class Nil;
 class Subscript;
 class Tuple;
 class Unop;
 class ValueOf;
 class Variable;
+class Vector;
 class While;
 
 class AstVisitor {
@@ -50,16 +55,21 @@ public:
   virtual void Visit(Binop *binop) noexcept             = 0;
   virtual void Visit(Block *block) noexcept             = 0;
   virtual void Visit(Boolean *boolean) noexcept         = 0;
+  virtual void Visit(Cast *cast) noexcept               = 0;
   virtual void Visit(IfThenElse *conditional) noexcept  = 0;
   virtual void Visit(Dot *dot) noexcept                 = 0;
+  virtual void Visit(Float *literal) noexcept           = 0;
+  virtual void Visit(For *loop) noexcept                = 0;
   virtual void Visit(Function *function) noexcept       = 0;
   virtual void Visit(Integer *integer) noexcept         = 0;
+  virtual void Visit(Intrinsic *intrinsic) noexcept     = 0;
   virtual void Visit(Nil *nil) noexcept                 = 0;
   virtual void Visit(Subscript *subscript) noexcept     = 0;
   virtual void Visit(Tuple *tuple) noexcept             = 0;
   virtual void Visit(Unop *unop) noexcept               = 0;
   virtual void Visit(ValueOf *value_of) noexcept        = 0;
   virtual void Visit(Variable *variable) noexcept       = 0;
+  virtual void Visit(Vector *vector) noexcept           = 0;
   virtual void Visit(While *loop) noexcept              = 0;
 
   AstVisitor() noexcept                                            = default;
@@ -80,16 +90,21 @@ public:
   virtual void Visit(const Binop *binop) const noexcept             = 0;
   virtual void Visit(const Block *block) const noexcept             = 0;
   virtual void Visit(const Boolean *boolean) const noexcept         = 0;
+  virtual void Visit(const Cast *cast) const noexcept               = 0;
   virtual void Visit(const IfThenElse *conditional) const noexcept  = 0;
   virtual void Visit(const Dot *dot) const noexcept                 = 0;
+  virtual void Visit(const Float *literal) const noexcept           = 0;
+  virtual void Visit(const For *loop) const noexcept                = 0;
   virtual void Visit(const Function *function) const noexcept       = 0;
   virtual void Visit(const Integer *integer) const noexcept         = 0;
+  virtual void Visit(const Intrinsic *intrinsic) const noexcept     = 0;
   virtual void Visit(const Nil *nil) const noexcept                 = 0;
   virtual void Visit(const Subscript *subscript) const noexcept     = 0;
   virtual void Visit(const Tuple *tuple) const noexcept             = 0;
   virtual void Visit(const Unop *unop) const noexcept               = 0;
   virtual void Visit(const ValueOf *value_of) const noexcept        = 0;
   virtual void Visit(const Variable *variable) const noexcept       = 0;
+  virtual void Visit(const Vector *vector) const noexcept           = 0;
   virtual void Visit(const While *loop) const noexcept              = 0;
 
   ConstAstVisitor() noexcept                             = default;
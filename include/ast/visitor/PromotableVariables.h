@@ -0,0 +1,92 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/**
+ * @file PromotableVariables.h
+ * @brief Header for class PromotableVariables
+ * @version 0.1
+ */
+#pragma once
+#include "llvm/ADT/DenseSet.h"
+
+#include "ast/visitor/AstVisitor.h"
+#include "aux/StringInterner.h"
+
+namespace pink {
+class Ast;
+
+/**
+ * @brief Finds the local variables of a function body which
+ * can be kept directly as SSA values during Codegen.
+ *
+ * a variable is promotable if it is introduced by a Bind or a For
+ * loop within the body and it is only ever read, or assigned to directly
+ * (x = ...). a variable appearing beneath an AddressOf, or within
+ * the left hand side of any other assignment (*x = ..., x[i] = ...)
+ * is not promotable, as it's memory may be used.
+ *
+ * #NOTE: this is by name, not by binding site. a name may be bound
+ * more than once per function, by sibling loops or by a loop
+ * variable shadowing a Bind, and these share a single answer, so
+ * taking the address of any one of them keeps every binding of
+ * that name in memory. Codegen keeps the SSA bindings themselves
+ * apart by scope.
+ */
+class PromotableVariables : public ConstAstVisitor {
+public:
+  using Set = llvm::DenseSet<InternedString>;
+
+private:
+  mutable Set  bound;
+  mutable Set  escaping;
+  mutable bool within_address = false;
+
+  void Analyze(const Ast *ast) const noexcept;
+
+public:
+  /**
+   * @brief computes the promotable variables of the given function body
+   */
+  static auto Compute(const Ast *body) noexcept -> Set;
+
+  void Visit(const AddressOf *address_of) const noexcept override;
+  void Visit(const Application *application) const noexcept override;
+  void Visit(const Array *array) const noexcept override;
+  void Visit(const Assignment *assignment) const noexcept override;
+  void Visit(const Bind *bind) const noexcept override;
+  void Visit(const Binop *binop) const noexcept override;
+  void Visit(const Block *block) const noexcept override;
+  void Visit(const Boolean *boolean) const noexcept override;
+  void Visit(const Cast *cast) const noexcept override;
+  void Visit(const IfThenElse *conditional) const noexcept override;
+  void Visit(const Dot *dot) const noexcept override;
+  void Visit(const Float *literal) const noexcept override;
+  void Visit(const For *loop) const noexcept override;
+  void Visit(const Function *function) const noexcept override;
+  void Visit(const Integer *integer) const noexcept override;
+  void Visit(const Intrinsic *intrinsic) const noexcept override;
+  void Visit(const Nil *nil) const noexcept override;
+  void Visit(const Subscript *subscript) const noexcept override;
+  void Visit(const Tuple *tuple) const noexcept override;
+  void Visit(const Unop *unop) const noexcept override;
+  void Visit(const ValueOf *value_of) const noexcept override;
+  void Visit(const Variable *variable) const noexcept override;
+  void Visit(const Vector *vector) const noexcept override;
+  void Visit(const While *loop) const noexcept override;
+};
+} // namespace pink
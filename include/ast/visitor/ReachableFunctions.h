@@ -0,0 +1,91 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/**
+ * @file ReachableFunctions.h
+ * @brief Header for class ReachableFunctions
+ * @version 0.1
+ */
+#pragma once
+#include <vector>
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseSet.h"
+
+#include "ast/Ast.h"
+#include "ast/visitor/AstVisitor.h"
+#include "aux/StringInterner.h"
+
+namespace pink {
+/**
+ * @brief Finds the top level functions reachable from a set of
+ * root symbols, such as main.
+ *
+ * a function is reachable if it is a root, or it's name is
+ * referenced within the body of a reachable function, or
+ * within any top level term which is not a function.
+ *
+ * #NOTE: this is by name, and every variable referenced within
+ * a body is considered, so a local variable sharing the name
+ * of a function keeps that function reachable. This is
+ * conservative, never unsound.
+ */
+class ReachableFunctions : public ConstAstVisitor {
+public:
+  using Set   = llvm::DenseSet<InternedString>;
+  using Terms = std::vector<Ast::Pointer>;
+
+private:
+  mutable std::vector<InternedString> referenced;
+
+  void Analyze(const Ast *ast) const noexcept;
+
+public:
+  /**
+   * @brief computes the names of the functions within terms
+   * which are reachable from the given roots.
+   */
+  static auto Compute(const Terms                   &terms,
+                      llvm::ArrayRef<InternedString> roots) noexcept -> Set;
+
+  void Visit(const AddressOf *address_of) const noexcept override;
+  void Visit(const Application *application) const noexcept override;
+  void Visit(const Array *array) const noexcept override;
+  void Visit(const Assignment *assignment) const noexcept override;
+  void Visit(const Bind *bind) const noexcept override;
+  void Visit(const Binop *binop) const noexcept override;
+  void Visit(const Block *block) const noexcept override;
+  void Visit(const Boolean *boolean) const noexcept override;
+  void Visit(const Cast *cast) const noexcept override;
+  void Visit(const IfThenElse *conditional) const noexcept override;
+  void Visit(const Dot *dot) const noexcept override;
+  void Visit(const Float *literal) const noexcept override;
+  void Visit(const For *loop) const noexcept override;
+  void Visit(const Function *function) const noexcept override;
+  void Visit(const Integer *integer) const noexcept override;
+  void Visit(const Intrinsic *intrinsic) const noexcept override;
+  void Visit(const Nil *nil) const noexcept override;
+  void Visit(const Subscript *subscript) const noexcept override;
+  void Visit(const Tuple *tuple) const noexcept override;
+  void Visit(const Unop *unop) const noexcept override;
+  void Visit(const ValueOf *value_of) const noexcept override;
+  void Visit(const Variable *variable) const noexcept override;
+  void Visit(const Vector *vector) const noexcept override;
+  void Visit(const While *loop) const noexcept override;
+};
+} // namespace pink
@@ -26,10 +26,12 @@
 #include <filesystem>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 #include "aux/Outcome.h"
 
 #include "llvm/Passes/OptimizationLevel.h"
+#include "llvm/Support/CodeGen.h"
 
 namespace fs = std::filesystem;
 
@@ -39,9 +41,23 @@ private:
   enum Flags {
     verbose,
     emit_llvmir,
+    emit_bitcode,
     emit_assembly,
     emit_object,
     link,
+    run,
+    link_time_optimization,
+    bounds_checks,
+    hoist_bounds_checks,
+    function_sections,
+    position_independent_code,
+    profile_generate,
+    print_pass_timings,
+    optimize_debug,
+    verify,
+    check_all,
+    whole_program,
+    fast_math,
     SIZE, // #NOTE! this -must- be the last member,
           // no enums can have an assigned value.
   };
@@ -52,8 +68,9 @@ private:
 
 public:
   CLIFlags() {
-    set[emit_object] = true;
-    set[link]        = true;
+    set[link]          = true;
+    set[bounds_checks] = true;
+    set[verify]        = true;
   }
 
   auto DoVerbose(bool state) noexcept -> bool { return set[verbose] = state; }
@@ -66,6 +83,13 @@ public:
     return set[emit_llvmir];
   }
 
+  auto DoEmitBitcode(bool state) noexcept -> bool {
+    return set[emit_bitcode] = state;
+  }
+  [[nodiscard]] auto DoEmitBitcode() const noexcept -> bool {
+    return set[emit_bitcode];
+  }
+
   auto DoEmitAssembly(bool state) noexcept -> bool {
     return set[emit_assembly] = state;
   }
@@ -82,6 +106,89 @@ public:
 
   auto DoLink(bool state) noexcept -> bool { return set[link] = state; }
   [[nodiscard]] auto DoLink() const noexcept -> bool { return set[link]; }
+
+  auto DoRun(bool state) noexcept -> bool { return set[run] = state; }
+  [[nodiscard]] auto DoRun() const noexcept -> bool { return set[run]; }
+
+  auto DoLinkTimeOptimization(bool state) noexcept -> bool {
+    return set[link_time_optimization] = state;
+  }
+  [[nodiscard]] auto DoLinkTimeOptimization() const noexcept -> bool {
+    return set[link_time_optimization];
+  }
+
+  auto DoBoundsChecks(bool state) noexcept -> bool {
+    return set[bounds_checks] = state;
+  }
+  [[nodiscard]] auto DoBoundsChecks() const noexcept -> bool {
+    return set[bounds_checks];
+  }
+
+  auto DoHoistBoundsChecks(bool state) noexcept -> bool {
+    return set[hoist_bounds_checks] = state;
+  }
+  [[nodiscard]] auto DoHoistBoundsChecks() const noexcept -> bool {
+    return set[hoist_bounds_checks];
+  }
+
+  auto DoFunctionSections(bool state) noexcept -> bool {
+    return set[function_sections] = state;
+  }
+  [[nodiscard]] auto DoFunctionSections() const noexcept -> bool {
+    return set[function_sections];
+  }
+
+  auto DoPositionIndependentCode(bool state) noexcept -> bool {
+    return set[position_independent_code] = state;
+  }
+  [[nodiscard]] auto DoPositionIndependentCode() const noexcept -> bool {
+    return set[position_independent_code];
+  }
+
+  auto DoProfileGenerate(bool state) noexcept -> bool {
+    return set[profile_generate] = state;
+  }
+  [[nodiscard]] auto DoProfileGenerate() const noexcept -> bool {
+    return set[profile_generate];
+  }
+
+  auto DoPrintPassTimings(bool state) noexcept -> bool {
+    return set[print_pass_timings] = state;
+  }
+  [[nodiscard]] auto DoPrintPassTimings() const noexcept -> bool {
+    return set[print_pass_timings];
+  }
+
+  auto DoOptimizeDebug(bool state) noexcept -> bool {
+    return set[optimize_debug] = state;
+  }
+  [[nodiscard]] auto DoOptimizeDebug() const noexcept -> bool {
+    return set[optimize_debug];
+  }
+
+  auto DoVerify(bool state) noexcept -> bool { return set[verify] = state; }
+  [[nodiscard]] auto DoVerify() const noexcept -> bool { return set[verify]; }
+
+  auto DoCheckAll(bool state) noexcept -> bool {
+    return set[check_all] = state;
+  }
+  [[nodiscard]] auto DoCheckAll() const noexcept -> bool {
+    return set[check_all];
+  }
+
+  auto DoWholeProgram(bool state) noexcept -> bool {
+    return set[whole_program] = state;
+  }
+  [[nodiscard]] auto DoWholeProgram() const noexcept -> bool {
+    return set[whole_program];
+  }
+
+  auto DoFastMath(bool state) noexcept -> bool {
+    return set[fast_math] = state;
+  }
+  [[nodiscard]] auto DoFastMath() const noexcept -> bool {
+    return set[fast_math];
+  }
 };
 
 /**
@@ -91,34 +198,62 @@ public:
  */
 class CLIOptions {
 private:
-  fs::path                input_file;
-  fs::path                output_file;
-  fs::path                llvmir_file;
-  fs::path                assembly_file;
-  fs::path                object_file;
-  CLIFlags                flags;
-  llvm::OptimizationLevel optimization_level;
+  fs::path                 input_file;
+  fs::path                 output_file;
+  fs::path                 llvmir_file;
+  fs::path                 bitcode_file;
+  fs::path                 assembly_file;
+  fs::path                 object_file;
+  fs::path                 profile_generate_file;
+  fs::path                 profile_use_file;
+  std::string              target_cpu;
+  std::string              target_features;
+  std::string              passes;
+  std::vector<std::string> exports;
+  CLIFlags                 flags;
+  llvm::OptimizationLevel  optimization_level;
 
 public:
+  static constexpr auto native_cpu = "native";
+
   CLIOptions()
-      : optimization_level(llvm::OptimizationLevel::O0) {}
+      : target_cpu{native_cpu},
+        optimization_level(llvm::OptimizationLevel::O0) {}
   // we can lazily construct assembly_file and object_file
   // here for minor savings in the cases where we are not
   // generating assembly or object files.
-  CLIOptions(fs::path                infile,
-             fs::path                outfile,
-             CLIFlags                flags,
-             llvm::OptimizationLevel optimization_level)
+  CLIOptions(fs::path                 infile,
+             fs::path                 outfile,
+             CLIFlags                 flags,
+             llvm::OptimizationLevel  optimization_level,
+             std::string              target_cpu            = native_cpu,
+             std::string              target_features       = {},
+             fs::path                 profile_generate_file = {},
+             fs::path                 profile_use_file      = {},
+             std::string              passes                = {},
+             std::vector<std::string> exports               = {})
       : input_file{std::move(infile)},
         output_file{std::move(outfile)},
         llvmir_file{output_file},
+        bitcode_file{output_file},
         assembly_file{output_file},
         object_file{output_file},
+        profile_generate_file{std::move(profile_generate_file)},
+        profile_use_file{std::move(profile_use_file)},
+        target_cpu{std::move(target_cpu)},
+        target_features{std::move(target_features)},
+        passes{std::move(passes)},
+        exports{std::move(exports)},
         flags{flags},
         optimization_level{optimization_level} {
     llvmir_file.replace_extension("ll");
+    bitcode_file.replace_extension("bc");
     assembly_file.replace_extension("s");
     object_file.replace_extension("o");
+    if (this->profile_generate_file.empty()) {
+      this->profile_generate_file = output_file;
+      this->profile_generate_file.replace_extension("profraw");
+    }
   }
   ~CLIOptions() noexcept                                           = default;
   CLIOptions(const CLIOptions &other) noexcept                     = default;
@@ -146,6 +281,9 @@ public:
   [[nodiscard]] auto DoEmitLLVMIR() const noexcept -> bool {
     return flags.DoEmitLLVMIR();
   }
+  [[nodiscard]] auto DoEmitBitcode() const noexcept -> bool {
+    return flags.DoEmitBitcode();
+  }
   [[nodiscard]] auto DoEmitAssembly() const noexcept -> bool {
     return flags.DoEmitAssembly();
   }
@@ -153,6 +291,46 @@ public:
     return flags.DoEmitObject();
   }
   [[nodiscard]] auto DoLink() const noexcept -> bool { return flags.DoLink(); }
+  [[nodiscard]] auto DoRun() const noexcept -> bool { return flags.DoRun(); }
+  [[nodiscard]] auto DoLinkTimeOptimization() const noexcept -> bool {
+    return flags.DoLinkTimeOptimization();
+  }
+  [[nodiscard]] auto DoBoundsChecks() const noexcept -> bool {
+    return flags.DoBoundsChecks();
+  }
+  [[nodiscard]] auto DoHoistBoundsChecks() const noexcept -> bool {
+    return flags.DoHoistBoundsChecks();
+  }
+  [[nodiscard]] auto DoFunctionSections() const noexcept -> bool {
+    return flags.DoFunctionSections();
+  }
+  [[nodiscard]] auto DoPositionIndependentCode() const noexcept -> bool {
+    return flags.DoPositionIndependentCode();
+  }
+  [[nodiscard]] auto DoProfileGenerate() const noexcept -> bool {
+    return flags.DoProfileGenerate();
+  }
+  [[nodiscard]] auto DoProfileUse() const noexcept -> bool {
+    return !profile_use_file.empty();
+  }
+  [[nodiscard]] auto DoPrintPassTimings() const noexcept -> bool {
+    return flags.DoPrintPassTimings();
+  }
+  [[nodiscard]] auto DoOptimizeDebug() const noexcept -> bool {
+    return flags.DoOptimizeDebug();
+  }
+  [[nodiscard]] auto DoVerify() const noexcept -> bool {
+    return flags.DoVerify();
+  }
+  [[nodiscard]] auto DoCheckAll() const noexcept -> bool {
+    return flags.DoCheckAll();
+  }
+  [[nodiscard]] auto DoWholeProgram() const noexcept -> bool {
+    return flags.DoWholeProgram();
+  }
+  [[nodiscard]] auto DoFastMath() const noexcept -> bool {
+    return flags.DoFastMath();
+  }
   [[nodiscard]] auto DoVerbose() const noexcept -> bool {
     return flags.DoVerbose();
   }
@@ -166,16 +344,83 @@ public:
   [[nodiscard]] auto GetLLVMIRFile() const -> const fs::path & {
     return llvmir_file;
   }
+  [[nodiscard]] auto GetBitcodeFile() const -> const fs::path & {
+    return bitcode_file;
+  }
   [[nodiscard]] auto GetObjectFile() const -> const fs::path & {
     return object_file;
   }
   [[nodiscard]] auto GetAssemblyFile() const -> const fs::path & {
     return assembly_file;
   }
+  /**
+   * @brief the file an instrumented program writes its raw profile into.
+   */
+  [[nodiscard]] auto GetProfileGenerateFile() const -> const fs::path & {
+    return profile_generate_file;
+  }
+  /**
+   * @brief the merged profile (.profdata) to optimize with.
+   */
+  [[nodiscard]] auto GetProfileUseFile() const -> const fs::path & {
+    return profile_use_file;
+  }
 
   [[nodiscard]] auto GetOptimizationLevel() const -> llvm::OptimizationLevel {
     return optimization_level;
   }
+
+  /**
+   * @brief Get the backend optimization level corresponding
+   * to the IR optimization level.
+   *
+   * Os and Oz optimize for size within the IR pipeline,
+   * so they use the Default backend level, as clang does.
+   * Og is an O0 backend, such that instruction selection
+   * is done by FastISel.
+   */
+  [[nodiscard]] auto GetCodeGenOptLevel() const -> llvm::CodeGenOpt::Level {
+    switch (optimization_level.getSpeedupLevel()) {
+    case 0:
+      return llvm::CodeGenOpt::None;
+    case 1:
+      return llvm::CodeGenOpt::Less;
+    case 3:
+      return llvm::CodeGenOpt::Aggressive;
+    default:
+      return llvm::CodeGenOpt::Default;
+    }
+  }
+
+  /**
+   * @brief the target cpu, "native" meaning the host cpu.
+   *
+   * on x86-64 this may also be one of the microarchitecture
+   * levels x86-64, x86-64-v2, x86-64-v3, x86-64-v4
+   */
+  [[nodiscard]] auto GetTargetCPU() const -> const std::string & {
+    return target_cpu;
+  }
+  /**
+   * @brief additional target features, in the form "+avx2,-fma"
+   */
+  [[nodiscard]] auto GetTargetFeatures() const -> const std::string & {
+    return target_features;
+  }
+  /**
+   * @brief the textual pass pipeline replacing the default
+   * pipeline, empty when the default pipeline is used.
+   */
+  [[nodiscard]] auto GetPasses() const -> const std::string & {
+    return passes;
+  }
+  /**
+   * @brief the symbols which are compiled along with main,
+   * even when main does not reach them.
+   */
+  [[nodiscard]] auto GetExports() const -> const std::vector<std::string> & {
+    return exports;
+  }
 };
 
 auto ParseCLIOptions(std::ostream &out, int argc, char **argv)
@@ -22,6 +22,10 @@
  *
  */
 #pragma once
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
+
 // #include "llvm/IR/DIBuilder.h"
 #include "llvm/IR/IRBuilder.h"
 #include "llvm/IR/InlineAsm.h"
@@ -69,12 +73,26 @@ private:
   ScopeStack       scopes;
   BinopTable       binop_table;
   UnopTable        unop_table;
+  // the vector types whose lane wise operators are registered
+  llvm::DenseSet<Type::Pointer> vector_operators;
 
   std::unique_ptr<llvm::LLVMContext> context;
   std::unique_ptr<llvm::Module>      module;
   std::unique_ptr<llvm::IRBuilder<>> instruction_builder;
   llvm::TargetMachine               *target_machine;
   llvm::Function                    *current_function;
+  // global text, runtime error handlers and the runtime
+  // functions are emitted once per module, and shared by every use.
+  llvm::StringMap<llvm::GlobalVariable *> global_text;
+  llvm::StringMap<llvm::Function *>       runtime_errors;
+  llvm::StringMap<llvm::Function *>       runtime_functions;
+  // the local variables of the current function which are kept
+  // as SSA values, and those of them which are currently bound.
+  // ssa_scopes holds the number bound as each scope was pushed,
+  // so popping a scope unbinds the SSA variables bound within it.
+  llvm::DenseSet<InternedString> promotable_variables;
+  std::vector<InternedString>    ssa_variables;
+  std::vector<std::size_t>       ssa_scopes;
   // 2/6/2023
   // we still are not ready to add debug information just
   // yet. even though we cannot implement functions as values
@@ -97,11 +115,18 @@ private:
         scopes{},
         binop_table{},
         unop_table{},
+        vector_operators{},
         context{std::move(context)},
         module{std::move(module)},
         instruction_builder{std::move(instruction_builder)},
         target_machine{target_machine},
-        current_function{nullptr} {
+        current_function{nullptr},
+        global_text{},
+        runtime_errors{},
+        runtime_functions{},
+        promotable_variables{},
+        ssa_variables{},
+        ssa_scopes{} {
     assert(input != nullptr);
     assert(target_machine != nullptr);
   }
@@ -115,11 +140,18 @@ private:
         scopes{},
         binop_table{},
         unop_table{},
+        vector_operators{},
         context{nullptr},
         module{nullptr},
         instruction_builder{nullptr},
         target_machine{nullptr},
-        current_function{nullptr} {}
+        current_function{nullptr},
+        global_text{},
+        runtime_errors{},
+        runtime_functions{},
+        promotable_variables{},
+        ssa_variables{},
+        ssa_scopes{} {}
 
 public:
   ~CompilationUnit()                                                = default;
@@ -129,8 +161,6 @@ public:
   auto operator=(CompilationUnit &&other) -> CompilationUnit      & = default;
 
   // CompilationUnit methods
-  auto ToConstantInit(std::string_view text) -> std::vector<llvm::Constant *>;
-
   auto Gensym(std::string_view prefix = "__") -> InternedString;
 
   void PrintErrorWithSourceText(std::ostream &out, const Error &error) const {
@@ -140,7 +170,35 @@ public:
 
   auto EmitFiles(std::ostream &err) const -> int;
   auto EmitLLVMIRFile(std::ostream &err) const -> int;
+  auto EmitBitcodeFile(std::ostream &err) const -> int;
+  auto EmitBitcodeBuffer(llvm::SmallVectorImpl<char> &buffer,
+                         std::ostream                &err) const -> int;
+  /**
+   * @brief Writes the module as bitcode along with a ThinLTO module
+   * summary, such that lld can perform ThinLTO on the output.
+   *
+   * @param outstream the stream to write the bitcode to
+   * @param err the stream to write errors to
+   * @return int EXIT_SUCCESS or EXIT_FAILURE
+   */
+  auto EmitBitcode(llvm::raw_ostream &outstream, std::ostream &err) const
+      -> int;
   auto EmitObjectFile(std::ostream &err) const -> int;
+  /**
+   * @brief Emits the object code of this CompilationUnit into memory
+   *
+   * this is how the object code is handed to the linker, such that
+   * the object file only touches the filesystem when it is the
+   * requested output.
+   *
+   * @param buffer the buffer to write the object code into
+   * @param err the stream to write errors to
+   * @return int EXIT_SUCCESS or EXIT_FAILURE
+   */
+  auto EmitObjectBuffer(llvm::SmallVectorImpl<char> &buffer,
+                        std::ostream                &err) const -> int;
+  auto EmitObject(llvm::raw_pwrite_stream &outstream, std::ostream &err) const
+      -> int;
   auto EmitAssemblyFile(std::ostream &err) const -> int;
 
   using Term   = Ast::Pointer;
@@ -149,6 +207,11 @@ public:
 
   auto Compile(std::ostream &out, std::ostream &err) -> int;
   auto ParseInputFile(std::ostream &err) -> Outcome<Terms, Error>;
+  /**
+   * @brief parses every term from the current input stream
+   */
+  auto ParseTerms() -> Outcome<Terms, Error>;
+  auto RemoveUnreachableFunctions(Terms &terms, std::ostream &out) -> void;
   auto TypecheckTerms(Terms &terms) -> std::optional<Errors>;
   auto CodegenTerms(Terms &terms) -> std::optional<Error>;
 
@@ -223,6 +286,54 @@ public:
   [[nodiscard]] auto DoEmitAssembly() const noexcept -> bool {
     return cli_options.DoEmitAssembly();
   }
+  [[nodiscard]] auto DoRun() const noexcept -> bool {
+    return cli_options.DoRun();
+  }
+  [[nodiscard]] auto DoEmitBitcode() const noexcept -> bool {
+    return cli_options.DoEmitBitcode();
+  }
+  [[nodiscard]] auto DoLinkTimeOptimization() const noexcept -> bool {
+    return cli_options.DoLinkTimeOptimization();
+  }
+  [[nodiscard]] auto DoBoundsChecks() const noexcept -> bool {
+    return cli_options.DoBoundsChecks();
+  }
+  [[nodiscard]] auto DoHoistBoundsChecks() const noexcept -> bool {
+    return cli_options.DoHoistBoundsChecks();
+  }
+  [[nodiscard]] auto DoFunctionSections() const noexcept -> bool {
+    return cli_options.DoFunctionSections();
+  }
+  /**
+   * @brief true when the program is instrumented, and so
+   * writes it's profile when it exits.
+   *
+   * there are no linker defined profile section bounds within the
+   * JIT, and only the default pipelines add the instrumentation,
+   * so neither -Og nor --passes instrument the program.
+   */
+  [[nodiscard]] auto DoProfileGenerate() const noexcept -> bool {
+    return cli_options.DoProfileGenerate() && !cli_options.DoRun() &&
+           !cli_options.DoOptimizeDebug() && cli_options.GetPasses().empty();
+  }
+  [[nodiscard]] auto DoProfileUse() const noexcept -> bool {
+    return cli_options.DoProfileUse();
+  }
+  [[nodiscard]] auto DoPrintPassTimings() const noexcept -> bool {
+    return cli_options.DoPrintPassTimings();
+  }
+  [[nodiscard]] auto DoOptimizeDebug() const noexcept -> bool {
+    return cli_options.DoOptimizeDebug();
+  }
+  [[nodiscard]] auto DoVerify() const noexcept -> bool {
+    return cli_options.DoVerify();
+  }
+  [[nodiscard]] auto DoCheckAll() const noexcept -> bool {
+    return cli_options.DoCheckAll();
+  }
+  [[nodiscard]] auto DoWholeProgram() const noexcept -> bool {
+    return cli_options.DoWholeProgram();
+  }
 
   [[nodiscard]] auto GetInputFile() const -> const fs::path & {
     return cli_options.GetInputFile();
@@ -233,16 +344,51 @@ public:
   [[nodiscard]] auto GetLLVMIRFile() const -> const fs::path & {
     return cli_options.GetLLVMIRFile();
   }
+  [[nodiscard]] auto GetBitcodeFile() const -> const fs::path & {
+    return cli_options.GetBitcodeFile();
+  }
   [[nodiscard]] auto GetObjectFile() const -> const fs::path & {
     return cli_options.GetObjectFile();
   }
   [[nodiscard]] auto GetAssemblyFile() const -> const fs::path & {
     return cli_options.GetAssemblyFile();
   }
+  [[nodiscard]] auto GetProfileGenerateFile() const -> const fs::path & {
+    return cli_options.GetProfileGenerateFile();
+  }
+  [[nodiscard]] auto GetProfileUseFile() const -> const fs::path & {
+    return cli_options.GetProfileUseFile();
+  }
 
   [[nodiscard]] auto GetOptimizationLevel() const -> llvm::OptimizationLevel {
     return cli_options.GetOptimizationLevel();
   }
+  [[nodiscard]] auto GetCodeGenOptLevel() const -> llvm::CodeGenOpt::Level {
+    return cli_options.GetCodeGenOptLevel();
+  }
+  [[nodiscard]] auto GetPasses() const -> const std::string & {
+    return cli_options.GetPasses();
+  }
+  [[nodiscard]] auto GetExports() const -> const std::vector<std::string> & {
+    return cli_options.GetExports();
+  }
+  /**
+   * @brief is the function with the given name visible outside
+   * of the module?
+   *
+   * within the whole program only main and the exported
+   * functions are external, otherwise every function is.
+   */
+  [[nodiscard]] auto IsExternal(std::string_view name) const -> bool;
+  [[nodiscard]] auto GetTargetTriple() const -> const llvm::Triple & {
+    return target_machine->getTargetTriple();
+  }
+  [[nodiscard]] auto GetTargetCPU() const -> std::string_view {
+    return target_machine->getTargetCPU();
+  }
+  [[nodiscard]] auto GetTargetFeatures() const -> std::string_view {
+    return target_machine->getTargetFeatureString();
+  }
 
   // exposing Parser's interface
   [[nodiscard]] auto EndOfInput() const -> bool { return parser.EndOfInput(); }
@@ -273,6 +419,15 @@ public:
   auto GetIntType(Type::Annotations annotations) -> IntegerType::Pointer {
     return type_interner.GetIntType(annotations);
   }
+  auto GetSizedIntType(Type::Annotations annotations,
+                       unsigned          bit_width,
+                       bool is_signed) -> SizedIntegerType::Pointer {
+    return type_interner.GetSizedIntType(annotations, bit_width, is_signed);
+  }
+  auto GetFloatType(Type::Annotations annotations, unsigned bit_width)
+      -> FloatType::Pointer {
+    return type_interner.GetFloatType(annotations, bit_width);
+  }
   auto GetCharacterType(Type::Annotations annotations)
       -> CharacterType::Pointer {
     return type_interner.GetCharacterType(annotations);
@@ -310,6 +465,20 @@ public:
     return type_interner.GetTupleType(annotations, std::move(elements));
   }
 
+  /**
+   * @brief the lane wise operators of a vector type are
+   * registered the first time the vector type is asked for.
+   */
+  auto GetVectorType(Type::Annotations annotations,
+                     std::size_t       length,
+                     Type::Pointer     element_type) -> VectorType::Pointer;
+
+  /**
+   * @brief the type of a single lane of the given vector type.
+   * a lane is never in memory, so it's address cannot be taken.
+   */
+  auto GetLaneType(VectorType::Pointer vector_type) -> Type::Pointer;
+
   auto GetTextType(Type::Annotations annotations, std::size_t length)
       -> ArrayType::Pointer {
     return type_interner.GetTextType(annotations, length);
@@ -327,9 +496,20 @@ public:
   }
 
   // exposing ScopeStack's interface
-  void ResetScopes() { scopes.Reset(); }
-  void PushScope() { scopes.PushScope(); }
-  void PopScope() { scopes.PopScope(); }
+  void ResetScopes() {
+    scopes.Reset();
+    ssa_scopes.clear();
+  }
+  void PushScope() {
+    scopes.PushScope();
+    ssa_scopes.emplace_back(ssa_variables.size());
+  }
+  void PopScope() {
+    scopes.PopScope();
+    assert(!ssa_scopes.empty());
+    UnbindSSAVariables(std::min(ssa_scopes.back(), ssa_variables.size()));
+    ssa_scopes.pop_back();
+  }
 
   auto LookupVariable(InternedString symbol)
       -> std::optional<ScopeStack::Symbol> {
@@ -349,6 +529,81 @@ public:
     scopes.Bind(symbol, type, value);
   }
 
+  // SSA variables
+  /*
+    local variables which are never used by address are bound
+    directly to their current value, rather than to an alloca.
+    where control flow merges, the values a variable has along
+    each incoming edge are merged with a phi node.
+  */
+  using SSAValues = llvm::SmallVector<llvm::Value *, 8>;
+  struct SSALoop {
+    llvm::BasicBlock                     *preheader;
+    SSAValues                             incoming;
+    llvm::SmallVector<llvm::PHINode *, 8> phis;
+  };
+
+  void SetPromotableVariables(llvm::DenseSet<InternedString> variables) {
+    promotable_variables = std::move(variables);
+    ssa_variables.clear();
+  }
+  [[nodiscard]] auto IsPromotable(InternedString symbol) const -> bool {
+    return promotable_variables.contains(symbol);
+  }
+  void BindSSAVariable(InternedString symbol,
+                       Type::Pointer  type,
+                       llvm::Value   *value) {
+    scopes.Bind(symbol, type, value, /* is_ssa */ true);
+    ssa_variables.emplace_back(symbol);
+  }
+  void AssignSSAVariable(InternedString symbol, llvm::Value *value);
+  /**
+   * @brief the current values of the bound SSA variables
+   */
+  auto SnapshotSSAVariables() -> SSAValues;
+  /**
+   * @brief rebinds the SSA variables to the given values, unbinding
+   * any SSA variables bound after the values were taken.
+   */
+  void RestoreSSAVariables(const SSAValues &values);
+  /**
+   * @brief unbinds the SSA variables bound after the first [count]
+   */
+  void UnbindSSAVariables(std::size_t count) {
+    assert(count <= ssa_variables.size());
+    ssa_variables.resize(count);
+  }
+  /**
+   * @brief merges the values of the SSA variables along two incoming
+   * edges at the current insertion point. Only the first [count]
+   * variables are merged, as those bound along either edge are
+   * not in scope past the merge.
+   */
+  void MergeSSAVariables(std::size_t       count,
+                         const SSAValues  &first,
+                         llvm::BasicBlock *first_block,
+                         const SSAValues  &second,
+                         llvm::BasicBlock *second_block);
+  /**
+   * @brief creates a phi for each SSA variable at the start of
+   * a loop header, called with the insertion point at the header.
+   */
+  auto BeginSSALoop(llvm::BasicBlock *preheader) -> SSALoop;
+  /**
+   * @brief completes the phis of the loop with the values from the
+   * latch, removing those of variables the loop does not change, and
+   * rebinds the SSA variables to their values [exit] on leaving the loop.
+   */
+  void EndSSALoop(SSALoop &loop, llvm::BasicBlock *latch, SSAValues exit);
+  /**
+   * @brief the llvm.loop metadata of a counted loop, to be attached
+   * to it's backedge. the loop is marked as making progress, along
+   * with the requested unroll count and vectorization width, where
+   * zero means no request is made.
+   */
+  auto LoopMetadata(std::size_t unroll_count, std::size_t vectorize_width)
+      -> llvm::MDNode *;
+
   // exposing BinopTable's interface
   auto RegisterBinop(Token                  opr,
                      Type::Pointer          left_t,
@@ -381,6 +636,9 @@ public:
   auto AllocateGlobalText(std::string_view name, std::string_view text)
       -> llvm::GlobalVariable *;
 
+  auto AllocateConstantGlobal(llvm::Constant *initializer)
+      -> llvm::GlobalVariable *;
+
   auto AllocateGlobal(std::string_view name,
                       llvm::Type      *type,
                       llvm::Constant  *initializer = nullptr)
@@ -395,6 +653,16 @@ public:
                         llvm::Value     *init = nullptr) -> llvm::Value *;
 
   // Loads and Stores
+  /**
+   * @brief aggregates larger than this many bytes are stored
+   * with a single llvm.memcpy.inline or llvm.memset.inline, rather
+   * than one store per element.
+   *
+   * the inline forms are never lowered to a libcall, which matters
+   * as a linked program has no libc to provide memcpy and memset.
+   */
+  static constexpr uint64_t aggregate_memcpy_threshold = 16;
+
   auto Load(llvm::Type *type, llvm::Value *source) -> llvm::Value *;
   void Store(llvm::Type *type, llvm::Value *source, llvm::Value *destination);
   void StoreAggregate(llvm::Type  *type,
@@ -495,6 +763,21 @@ public:
   auto ArraySubscript(llvm::StructType *array_type,
                       llvm::Value      *array_ptr,
                       llvm::Value      *index) -> llvm::Value *;
+  // vectors
+  // a vector is loaded from, or stored to, the (lanes) consecutive
+  // elements of an array or slice starting at index. only the first
+  // and last lane are bounds checked.
+  auto PtrToArrayLanes(llvm::StructType *array_type,
+                       llvm::Value      *array_ptr,
+                       llvm::Value      *index,
+                       std::size_t       lanes) -> llvm::Value *;
+  auto PtrToSliceLanes(llvm::StructType *slice_type,
+                       llvm::Type       *element_type,
+                       llvm::Value      *slice_ptr,
+                       llvm::Value      *index,
+                       std::size_t       lanes) -> llvm::Value *;
+  auto LaneIndex(llvm::FixedVectorType *vector_type, llvm::Value *index)
+      -> llvm::Value *;
   // structs
   auto PtrToStructElement(llvm::StructType *struct_type,
                           llvm::Value      *struct_ptr,
@@ -519,6 +802,10 @@ public:
                              llvm::IntegerType *from_type,
                              llvm::Type        *to_type,
                              bool is_target_signed) -> llvm::Value *;
+  auto CastFloatTo(llvm::Value *source,
+                   llvm::Type  *from_type,
+                   llvm::Type  *to_type,
+                   bool         is_target_signed) -> llvm::Value *;
   auto CastSExt(llvm::Value       *from,
                 llvm::IntegerType *from_type,
                 llvm::IntegerType *to_type) -> llvm::Value *;
@@ -527,14 +814,57 @@ public:
                 llvm::IntegerType *to_type) -> llvm::Value *;
 
   // Error Handling
+  /**
+   * @brief Emits a check that 0 <= index < upper, which
+   * exits the program with a runtime error if it fails.
+   *
+   * the check is emitted as a single unsigned comparison, with
+   * the in bounds branch marked as likely and the out of bounds
+   * block terminated by unreachable. This is the form which
+   * loop unswitching and inductive range check elimination
+   * recognize, such that checks can be hoisted out of loops.
+   *
+   * no check is emitted when bounds checks are disabled.
+   */
   void BoundsCheck(llvm::Value *upper, llvm::Value *index);
   void BoundsCheck(llvm::Value *upper, llvm::Value *offset, llvm::Value *index);
-  void RuntimeError(std::string_view description, llvm::Value *exit_code);
+  /**
+   * @brief Emits a call to the runtime error handler for the given
+   * kind of error, which writes the description to stderr and exits
+   * with the given exit code.
+   *
+   * each kind gets a single outlined handler, named
+   * runtime.error.[kind], such that each check site is only a
+   * compare and a branch to a call of the shared cold handler.
+   */
+  void RuntimeError(std::string_view kind,
+                    std::string_view description,
+                    llvm::Value     *exit_code);
+  auto RuntimeErrorHandler(std::string_view kind,
+                           std::string_view description)
+      -> llvm::Function *;
+  /**
+   * @brief Emits a check that the given condition holds, which
+   * exits the program with a runtime error reporting the
+   * description if it does not.
+   *
+   * the check is emitted in the same form as BoundsCheck, though
+   * unlike a BoundsCheck it is emitted even when bounds checks
+   * are disabled.
+   */
+  void RuntimeCheck(llvm::Value     *condition,
+                    std::string_view kind,
+                    std::string_view description);
 
   // System Calls
-  // #TODO: we could place these into library functions
-  // and emit function calls here. This would clean up
-  // emitted code.
+  /**
+   * @brief Emits the x86-64 linux syscall [number] with the
+   * given arguments, returning the result of the syscall.
+   */
+  auto SysCall(std::size_t number, llvm::ArrayRef<llvm::Value *> arguments)
+      -> llvm::Value *;
+  // #NOTE: SysWriteSlice and SysWriteText write through the
+  // buffered runtime, SysWrite is the raw write syscall.
   auto SysWriteSlice(llvm::Value      *filedes,
                      llvm::StructType *slice_type,
                      llvm::Value      *slice_pointer) -> llvm::Value *;
@@ -546,6 +876,161 @@ public:
 
   void SysExit(llvm::Value *exit_code);
 
+  /**
+   * @brief the symbol SysExit calls when compiling for --run
+   *
+   * the exit syscall would terminate the compiler itself when the
+   * program is executed in memory, so instead we call out to a
+   * function defined by the host (see core/Run.cpp) which returns
+   * control to the compiler.
+   */
+  static constexpr auto jit_exit_symbol = "__pink_jit_exit";
+
+  // Runtime
+  // #NOTE: the symbols of the runtime are not pink identifiers,
+  // so they never collide with the functions of a program. the
+  // runtime functions are found through runtime_functions, never
+  // by name within the module.
+  static constexpr uint64_t runtime_buffer_size      = 4096;
+  static constexpr auto     runtime_write_symbol     = "runtime.write";
+  static constexpr auto     runtime_write_all_symbol = "runtime.write_all";
+  static constexpr auto     runtime_flush_symbol     = "runtime.flush";
+  static constexpr auto     runtime_flush_all_symbol = "runtime.flush_all";
+
+  auto RuntimeWrite(llvm::Value *filedes, llvm::Value *size, llvm::Value *buffer)
+      -> llvm::Value *;
+  void RuntimeFlush(llvm::Value *filedes);
+  void RuntimeFlushAll();
+  auto RuntimeFunction(std::string_view name) -> llvm::Function *;
+  void EmitRuntime();
+
+  // Heap
+  /**
+   * @brief the size of the address space reserved for the arena,
+   * and for the pool. the reservation is made on first use, and
+   * the kernel only backs the pages which are touched.
+   */
+  static constexpr uint64_t heap_reserve_size        = uint64_t{1} << 36;
+  static constexpr uint64_t heap_smallest_size_class = 16;
+  static constexpr uint64_t heap_largest_size_class  = uint64_t{1} << 20;
+  static constexpr auto     heap_arena_alloc_symbol  = "runtime.arena_alloc";
+  static constexpr auto     heap_arena_reset_symbol  = "runtime.arena_reset";
+  static constexpr auto     heap_pool_alloc_symbol   = "runtime.pool_alloc";
+  static constexpr auto     heap_pool_free_symbol    = "runtime.pool_free";
+
+  /**
+   * @brief Allocates count zeroed elements of element_type from the
+   * arena, returning a pointer to the first element.
+   */
+  auto ArenaAllocate(llvm::Type *element_type, llvm::Value *count)
+      -> llvm::Value *;
+  /**
+   * @brief Releases every allocation made from the arena at once.
+   */
+  void ArenaReset();
+  /**
+   * @brief Allocates count zeroed elements of element_type from the
+   * size class pool, returning a pointer to the first element.
+   */
+  auto PoolAllocate(llvm::Type *element_type, llvm::Value *count)
+      -> llvm::Value *;
+  /**
+   * @brief Returns the count elements of element_type at buffer,
+   * allocated by PoolAllocate, to the pool.
+   */
+  void PoolFree(llvm::Type  *element_type,
+                llvm::Value *buffer,
+                llvm::Value *count);
+  auto HeapSize(llvm::Type *element_type, llvm::Value *count)
+      -> llvm::Value *;
+  auto HeapFunction(std::string_view name) -> llvm::Function *;
+  void EmitHeapRuntime();
+
+  // Memory
+  /**
+   * @brief pink programs are not linked against libc, so the module
+   * itself defines the routines llvm lowers the memory intrinsics to.
+   */
+  static constexpr auto memory_copy_symbol    = "memcpy";
+  static constexpr auto memory_move_symbol    = "memmove";
+  static constexpr auto memory_set_symbol     = "memset";
+  static constexpr auto memory_compare_symbol = "bcmp";
+
+  /**
+   * @brief the memory routines are called by name from the code
+   * llvm generates, so a program may not define functions with
+   * those names.
+   */
+  [[nodiscard]] static auto IsMemorySymbol(std::string_view name) -> bool {
+    return (name == memory_copy_symbol) || (name == memory_move_symbol) ||
+           (name == memory_set_symbol) || (name == memory_compare_symbol);
+  }
+
+  /**
+   * @brief the size in bytes of count elements of element_type
+   */
+  auto ElementsSize(llvm::Type *element_type, llvm::Value *count)
+      -> llvm::Value *;
+  /**
+   * @brief Copies count elements of element_type from source to
+   * destination, which must not overlap.
+   */
+  void CopyElements(llvm::Type  *element_type,
+                    llvm::Value *destination,
+                    llvm::Value *source,
+                    llvm::Value *count);
+  /**
+   * @brief Copies count elements of element_type from source to
+   * destination, which may overlap.
+   */
+  void MoveElements(llvm::Type  *element_type,
+                    llvm::Value *destination,
+                    llvm::Value *source,
+                    llvm::Value *count);
+  /**
+   * @brief Stores value into each of the count elements of
+   * element_type at destination.
+   */
+  void FillElements(llvm::Type  *element_type,
+                    llvm::Value *destination,
+                    llvm::Value *value,
+                    llvm::Value *count);
+  /**
+   * @brief Returns true if the count elements of element_type at
+   * left have the same representation as those at right.
+   */
+  auto CompareElements(llvm::Type  *element_type,
+                       llvm::Value *left,
+                       llvm::Value *right,
+                       llvm::Value *count) -> llvm::Value *;
+  /**
+   * @brief Emits a rep movsb copying size bytes from source to
+   * destination, backward from the last byte if backward is set.
+   */
+  void RepMovsb(llvm::Value *destination,
+                llvm::Value *source,
+                llvm::Value *size,
+                bool         backward = false);
+  /**
+   * @brief Emits a rep stosb storing the low byte of value, an i64,
+   * into size bytes from destination.
+   */
+  void RepStosb(llvm::Value *destination,
+                llvm::Value *value,
+                llvm::Value *size);
+  auto MemoryFunction(std::string_view name) -> llvm::Function *;
+  void EmitMemoryRuntime();
+
+  // Profiling
+  static constexpr auto profile_write_symbol = "profile.write";
+
+  /**
+   * @brief Emits a call to the function writing the raw profile
+   * of an instrumented program into GetProfileGenerateFile()
+   */
+  void ProfileWrite();
+  void EmitProfileRuntime();
+
   /*
    * Optimization
    */
@@ -577,10 +1062,32 @@ public:
   /*
    * llvm::Module interface
    */
+  /**
+   * @brief Releases ownership of the llvm::LLVMContext and llvm::Module
+   *
+   * \warning after this call no member function which requires
+   * the llvm::* members may be called on this CompilationUnit.
+   * this exists such that the module can be handed to the JIT.
+   */
+  auto ReleaseModule()
+      -> std::pair<std::unique_ptr<llvm::LLVMContext>,
+                   std::unique_ptr<llvm::Module>> {
+    instruction_builder.reset();
+    return {std::move(context), std::move(module)};
+  }
+
   auto AllocaAddressSpace() -> unsigned {
     return module->getDataLayout().getAllocaAddrSpace();
   }
 
+  auto TypeAllocSize(llvm::Type *type) -> uint64_t {
+    return module->getDataLayout().getTypeAllocSize(type).getFixedValue();
+  }
+
+  auto TypeAlignment(llvm::Type *type) -> llvm::Align {
+    return module->getDataLayout().getABITypeAlign(type);
+  }
+
   /*
    * exposing llvm::IRBuilder interface
    */
@@ -601,6 +1108,10 @@ public:
     return instruction_builder->getInt1(value);
   }
 
+  auto ConstantFloat(double value) -> llvm::Constant * {
+    return llvm::ConstantFP::get(instruction_builder->getDoubleTy(), value);
+  }
+
   static auto ConstantStruct(llvm::ArrayRef<llvm::Constant *> elements)
       -> llvm::Constant * {
     assert(!elements.empty());
@@ -621,8 +1132,22 @@ public:
     return ConstantStruct({size, ConstantBareArray(elements)});
   }
 
+  // #NOTE: the packed constants are held as a llvm::ConstantDataArray,
+  // which stores the raw bytes, rather than a llvm::Constant per element.
+  auto ConstantPackedArray(llvm::ArrayRef<uint64_t> elements)
+      -> llvm::Constant * {
+    auto *size = ConstantSize(elements.size());
+    auto *data = llvm::ConstantDataArray::get(*context, elements);
+    return ConstantStruct({size, data});
+  }
+
   auto ConstantText(std::string_view text) -> llvm::Constant * {
-    return ConstantArray(ToConstantInit(text));
+    auto *size = ConstantSize(text.size());
+    return ConstantStruct(
+        {size,
+         llvm::ConstantDataArray::getString(*context,
+                                            {text.data(), text.size()},
+                                            /* AddNull */ false)});
   }
 
   static auto
@@ -645,6 +1170,16 @@ public:
     return instruction_builder->getInt64Ty();
   }
 
+  auto LLVMSizedIntegerType(unsigned bit_width) -> llvm::IntegerType * {
+    return instruction_builder->getIntNTy(bit_width);
+  }
+
+  auto LLVMFloatType(unsigned bit_width) -> llvm::Type * {
+    assert((bit_width == 32) || (bit_width == 64));
+    return (bit_width == 32) ? instruction_builder->getFloatTy()
+                             : instruction_builder->getDoubleTy();
+  }
+
   auto LLVMCharacterType() -> llvm::IntegerType * {
     return instruction_builder->getInt8Ty();
   }
@@ -689,6 +1224,12 @@ public:
     return llvm::ArrayType::get(element_type, size);
   }
 
+  static auto LLVMVectorType(llvm::Type *element_type, std::size_t length)
+      -> llvm::FixedVectorType * {
+    return llvm::FixedVectorType::get(element_type,
+                                      static_cast<unsigned>(length));
+  }
+
   auto LLVMTextType(std::size_t size) -> llvm::StructType * {
     return LLVMArrayType(LLVMCharacterType(), size);
   }
@@ -767,6 +1308,8 @@ public:
   void LeaveCurrentFunction() {
     current_function = nullptr;
     instruction_builder->ClearInsertionPoint();
+    promotable_variables.clear();
+    ssa_variables.clear();
   }
 
   // Create*
@@ -842,6 +1385,127 @@ public:
     return instruction_builder->CreateStore(value, address, is_volatile);
   }
 
+  auto CreateAlignedLoad(llvm::Type        *type,
+                         llvm::Value       *address,
+                         llvm::Align        alignment,
+                         const llvm::Twine &name = "") {
+    return instruction_builder->CreateAlignedLoad(type,
+                                                  address,
+                                                  alignment,
+                                                  name);
+  }
+
+  auto CreateAlignedStore(llvm::Value *value,
+                          llvm::Value *address,
+                          llvm::Align  alignment) {
+    return instruction_builder->CreateAlignedStore(value, address, alignment);
+  }
+
+  auto CreateExtractElement(llvm::Value       *vector,
+                            llvm::Value       *index,
+                            const llvm::Twine &name = "") {
+    return instruction_builder->CreateExtractElement(vector, index, name);
+  }
+
+  auto CreateInsertElement(llvm::Value       *vector,
+                           llvm::Value       *element,
+                           llvm::Value       *index,
+                           const llvm::Twine &name = "") {
+    return instruction_builder->CreateInsertElement(vector,
+                                                    element,
+                                                    index,
+                                                    name);
+  }
+
+  auto CreateVectorSplat(std::size_t        length,
+                         llvm::Value       *element,
+                         const llvm::Twine &name = "") {
+    return instruction_builder->CreateVectorSplat(
+        static_cast<unsigned>(length),
+        element,
+        name);
+  }
+
+  auto CreateMemCpy(llvm::Value *destination,
+                    llvm::Align  destination_alignment,
+                    llvm::Value *source,
+                    llvm::Align  source_alignment,
+                    uint64_t     size) -> llvm::CallInst * {
+    return instruction_builder->CreateMemCpy(destination,
+                                             destination_alignment,
+                                             source,
+                                             source_alignment,
+                                             size);
+  }
+
+  auto CreateMemCpy(llvm::Value *destination,
+                    llvm::Align  destination_alignment,
+                    llvm::Value *source,
+                    llvm::Align  source_alignment,
+                    llvm::Value *size) -> llvm::CallInst * {
+    return instruction_builder->CreateMemCpy(destination,
+                                             destination_alignment,
+                                             source,
+                                             source_alignment,
+                                             size);
+  }
+
+  auto CreateMemCpyInline(llvm::Value *destination,
+                          llvm::Align  destination_alignment,
+                          llvm::Value *source,
+                          llvm::Align  source_alignment,
+                          uint64_t     size) -> llvm::CallInst * {
+    return instruction_builder->CreateMemCpyInline(
+        destination,
+        destination_alignment,
+        source,
+        source_alignment,
+        instruction_builder->getInt64(size));
+  }
+
+  auto CreateMemSetInline(llvm::Value *destination,
+                          llvm::Align  alignment,
+                          llvm::Value *value,
+                          uint64_t     size) -> llvm::CallInst * {
+    return instruction_builder->CreateMemSetInline(
+        destination,
+        alignment,
+        value,
+        instruction_builder->getInt64(size));
+  }
+
+  auto CreateMemSet(llvm::Value *destination,
+                    llvm::Value *value,
+                    uint64_t     size,
+                    llvm::Align  alignment) -> llvm::CallInst * {
+    return instruction_builder->CreateMemSet(destination,
+                                             value,
+                                             size,
+                                             alignment);
+  }
+
+  auto CreateMemSet(llvm::Value *destination,
+                    llvm::Value *value,
+                    llvm::Value *size,
+                    llvm::Align  alignment) -> llvm::CallInst * {
+    return instruction_builder->CreateMemSet(destination,
+                                             value,
+                                             size,
+                                             alignment);
+  }
+
+  auto CreateMemMove(llvm::Value *destination,
+                     llvm::Align  destination_alignment,
+                     llvm::Value *source,
+                     llvm::Align  source_alignment,
+                     llvm::Value *size) -> llvm::CallInst * {
+    return instruction_builder->CreateMemMove(destination,
+                                              destination_alignment,
+                                              source,
+                                              source_alignment,
+                                              size);
+  }
+
   auto CreateCondBr(llvm::Value      *test,
                     llvm::BasicBlock *true_branch,
                     llvm::BasicBlock *false_branch,
@@ -859,6 +1523,10 @@ public:
     return instruction_builder->CreateBr(block);
   }
 
+  auto CreateUnreachable() -> llvm::UnreachableInst * {
+    return instruction_builder->CreateUnreachable();
+  }
+
   auto CreatePHI(llvm::Type        *type,
                  unsigned int       reserved_values,
                  const llvm::Twine &name = "") -> llvm::PHINode * {
@@ -922,6 +1590,69 @@ public:
     return instruction_builder->CreateSRem(left, right, name);
   }
 
+  auto CreateUDiv(llvm::Value       *left,
+                  llvm::Value       *right,
+                  const llvm::Twine &name     = "",
+                  bool               is_exact = false) {
+    return instruction_builder->CreateUDiv(left, right, name, is_exact);
+  }
+
+  auto CreateURem(llvm::Value       *left,
+                  llvm::Value       *right,
+                  const llvm::Twine &name = "") {
+    return instruction_builder->CreateURem(left, right, name);
+  }
+
+  auto CreateShl(llvm::Value       *left,
+                 llvm::Value       *right,
+                 const llvm::Twine &name = "") {
+    return instruction_builder->CreateShl(left, right, name);
+  }
+
+  auto CreateLShr(llvm::Value       *left,
+                  llvm::Value       *right,
+                  const llvm::Twine &name = "") {
+    return instruction_builder->CreateLShr(left, right, name);
+  }
+
+  auto CreateAShr(llvm::Value       *left,
+                  llvm::Value       *right,
+                  const llvm::Twine &name = "") {
+    return instruction_builder->CreateAShr(left, right, name);
+  }
+
+  // #NOTE: the floating point instructions carry the FastMathFlags
+  // of the instruction_builder, which are set by --fast-math.
+  auto CreateFAdd(llvm::Value       *left,
+                  llvm::Value       *right,
+                  const llvm::Twine &name = "") {
+    return instruction_builder->CreateFAdd(left, right, name);
+  }
+
+  auto CreateFSub(llvm::Value       *left,
+                  llvm::Value       *right,
+                  const llvm::Twine &name = "") {
+    return instruction_builder->CreateFSub(left, right, name);
+  }
+
+  auto CreateFMul(llvm::Value       *left,
+                  llvm::Value       *right,
+                  const llvm::Twine &name = "") {
+    return instruction_builder->CreateFMul(left, right, name);
+  }
+
+  auto CreateFDiv(llvm::Value       *left,
+                  llvm::Value       *right,
+                  const llvm::Twine &name = "") {
+    return instruction_builder->CreateFDiv(left, right, name);
+  }
+
+  auto CreateFRem(llvm::Value       *left,
+                  llvm::Value       *right,
+                  const llvm::Twine &name = "") {
+    return instruction_builder->CreateFRem(left, right, name);
+  }
+
   auto CreateICmpEQ(llvm::Value       *left,
                     llvm::Value       *right,
                     const llvm::Twine &name = "") {
@@ -958,6 +1689,66 @@ public:
     return instruction_builder->CreateICmpSLE(left, right, name);
   }
 
+  auto CreateICmpULT(llvm::Value       *left,
+                     llvm::Value       *right,
+                     const llvm::Twine &name = "") {
+    return instruction_builder->CreateICmpULT(left, right, name);
+  }
+
+  auto CreateICmpULE(llvm::Value       *left,
+                     llvm::Value       *right,
+                     const llvm::Twine &name = "") {
+    return instruction_builder->CreateICmpULE(left, right, name);
+  }
+
+  auto CreateICmpUGT(llvm::Value       *left,
+                     llvm::Value       *right,
+                     const llvm::Twine &name = "") {
+    return instruction_builder->CreateICmpUGT(left, right, name);
+  }
+
+  auto CreateICmpUGE(llvm::Value       *left,
+                     llvm::Value       *right,
+                     const llvm::Twine &name = "") {
+    return instruction_builder->CreateICmpUGE(left, right, name);
+  }
+
+  auto CreateFCmpOEQ(llvm::Value       *left,
+                     llvm::Value       *right,
+                     const llvm::Twine &name = "") {
+    return instruction_builder->CreateFCmpOEQ(left, right, name);
+  }
+
+  auto CreateFCmpUNE(llvm::Value       *left,
+                     llvm::Value       *right,
+                     const llvm::Twine &name = "") {
+    return instruction_builder->CreateFCmpUNE(left, right, name);
+  }
+
+  auto CreateFCmpOLT(llvm::Value       *left,
+                     llvm::Value       *right,
+                     const llvm::Twine &name = "") {
+    return instruction_builder->CreateFCmpOLT(left, right, name);
+  }
+
+  auto CreateFCmpOLE(llvm::Value       *left,
+                     llvm::Value       *right,
+                     const llvm::Twine &name = "") {
+    return instruction_builder->CreateFCmpOLE(left, right, name);
+  }
+
+  auto CreateFCmpOGT(llvm::Value       *left,
+                     llvm::Value       *right,
+                     const llvm::Twine &name = "") {
+    return instruction_builder->CreateFCmpOGT(left, right, name);
+  }
+
+  auto CreateFCmpOGE(llvm::Value       *left,
+                     llvm::Value       *right,
+                     const llvm::Twine &name = "") {
+    return instruction_builder->CreateFCmpOGE(left, right, name);
+  }
+
   auto CreateAnd(llvm::Value       *left,
                  llvm::Value       *right,
                  const llvm::Twine &name = "") {
@@ -980,9 +1771,23 @@ public:
                                           no_signed_wrap);
   }
 
+  auto CreateFNeg(llvm::Value *right, const llvm::Twine &name = "") {
+    return instruction_builder->CreateFNeg(right, name);
+  }
+
   auto CreateNot(llvm::Value *right, const llvm::Twine &name = "") {
     return instruction_builder->CreateNot(right, name);
   }
+
+  auto CreateSelect(llvm::Value       *condition,
+                    llvm::Value       *true_value,
+                    llvm::Value       *false_value,
+                    const llvm::Twine &name = "") {
+    return instruction_builder->CreateSelect(condition,
+                                             true_value,
+                                             false_value,
+                                             name);
+  }
 };
 
 } // namespace pink
@@ -42,7 +42,10 @@ public:
     // command line argument errors
     UnknownOption,
     BadOptimizationLevel,
+    BadBoundsChecksMode,
+    BadRelocationModel,
     MissingInputFile,
+    IncompatibleOptions,
 
     // syntax errors
     EndOfFile,
@@ -70,10 +73,15 @@ public:
     MissingElse,
     MissingWhile,
     MissingDo,
+    MissingForId,
+    MissingIn,
+    MissingLoopHintNum,
+    UnknownLoopHint,
     UnknownBinop,
     UnknownUnop,
     UnknownBasicToken,
     UnknownTypeToken,
+    BadVectorType,
     BadTopLevelExpression,
 
     // type errors
@@ -90,6 +98,10 @@ public:
     CondTestExprTypeMismatch,
     CondBodyExprTypeMismatch,
     WhileTestTypeMismatch,
+    ForRangeTypeMismatch,
+    ForSequenceNotIterable,
+    VectorArgumentMismatch,
+    VectorLaneOutOfRange,
     DotLeftIsNotATuple,
     DotRightIsNotAnInt,
     DotIndexOutOfRange,
@@ -29,8 +29,17 @@
 namespace pink {
 class ScopeStack {
 public:
-  using Key   = InternedString;
-  using Value = std::pair<Type::Pointer, llvm::Value *>;
+  using Key = InternedString;
+  /*
+    a variable is bound either to the memory holding it's value,
+    or (if it is a local variable which is never used by address)
+    directly to it's current value, which is an SSA value.
+  */
+  struct Value {
+    Type::Pointer type;
+    llvm::Value  *value;
+    bool          is_ssa;
+  };
   using Scope = Map<Key, Value>;
   using Stack = std::list<Scope>;
 
@@ -48,8 +57,12 @@ public:
     auto operator=(Symbol &&element) noexcept -> Symbol      & = default;
 
     auto Name() noexcept -> InternedString { return element.Key(); }
-    auto Type() noexcept -> Type::Pointer { return element.Value().first; }
-    auto Value() noexcept -> llvm::Value * { return element.Value().second; }
+    auto Type() noexcept -> Type::Pointer { return element.Value().type; }
+    auto Value() noexcept -> llvm::Value * { return element.Value().value; }
+    auto Value(llvm::Value *value) noexcept -> llvm::Value * {
+      return element.Value().value = value;
+    }
+    auto IsSSA() noexcept -> bool { return element.Value().is_ssa; }
   };
 
 private:
@@ -87,8 +100,11 @@ public:
     return stack.front().Lookup(name);
   }
 
-  void Bind(InternedString name, Type::Pointer type, llvm::Value *value) {
-    stack.front().Register(name, {type, value});
+  void Bind(InternedString name,
+            Type::Pointer  type,
+            llvm::Value   *value,
+            bool           is_ssa = false) {
+    stack.front().Register(name, {type, value, is_ssa});
   }
 };
 } // namespace pink
@@ -21,13 +21,15 @@
  * @version 0.1
  *
  */
+#pragma once
 #include "aux/Environment.h"
 
 namespace pink {
 /**
  * @brief Runs lld on the given CompilationUnit
  *
- *  This function calls lld::elf::link
+ *  This function emits the object code into memory and
+ *  calls lld::elf::link on it.
  *
  * @param env the environment which emitted the object file to be linked
  */
@@ -0,0 +1,42 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/**
+ * @file Run.h
+ * @brief Header for the function Run
+ * @version 0.1
+ *
+ */
+#pragma once
+#include "aux/Environment.h"
+
+namespace pink {
+/**
+ * @brief Runs the program held by the given CompilationUnit in memory
+ *
+ * This function hands the llvm::Module to an llvm::orc::LLJIT instance
+ * and calls main within the compiler's process.
+ *
+ * \warning this releases the llvm::Module from the CompilationUnit.
+ *
+ * @param unit the CompilationUnit holding the program to be run
+ * @return int the exit code of the program, or EXIT_FAILURE if the
+ * program could not be run.
+ */
+auto Run(std::ostream &out, std::ostream &err, CompilationUnit &unit) -> int;
+} // namespace pink
@@ -63,6 +63,7 @@ block = "{" {term} "}"
 
 term = conditional
      | while
+     | for
      | bind
      | affix ";"
 
@@ -71,6 +72,10 @@ conditional = "if" "(" affix ")" block "else" block
 
 while = "while" "(" affix ")" block
 
+for = "for" id "in" affix [".." affix] {hint} "do" block
+
+hint = ("unroll" | "vectorize") integer
+
 affix = composite "=" affix
       | composite
 
@@ -80,13 +85,14 @@ composite = builtin binop infix-parser
 binop = "+"  |  "-"  |  "*"  | "/"
       | "&"  |  "|"  |  "!"  | "=="
       | "!=" |  "<"  |  "<=" | ">"
-      | ">="
+      | ">=" |  "<<" |  ">>"
 
 builtin = basic {"." basic | "[" basic "]" | "(" [affix {"," affix}] ")" }
          | basic
 
 basic = id [":=" affix]
       | integer
+      | float
       | unop builtin
       | "&" builtin
       | "*" builtin
@@ -95,21 +101,39 @@ basic = id [":=" affix]
       | "false"
       | "(" affix {"," affix} ")"
       | "[" affix {"," affix} "]"
+      | vector_type "(" affix {"," affix} ")"
+      | numeric_type "(" affix ")"
+      | intrinsic "(" [(type | affix) {"," affix}] ")"
 
 unop = "!" | "-"
 
 type = "Nil"
-     | "Integer"
+     | numeric_type
      | "Boolean"
      | "(" type {"," type} ")"
      | "[" type ";" integer "]"
+     | vector_type
      | "*" type
      | "*[]" type
      | type "->" type
 
+vector_type = "Vector" "<" type ";" integer ">"
+
+numeric_type = integer_type | float_type
+
+integer_type = "Integer" | sized_int
+
+float_type = "Float32" | "Float64"
+
+intrinsic = "arena_alloc" | "arena_reset" | "pool_alloc" | "pool_free"
+          | "mem_copy" | "mem_move" | "mem_fill" | "mem_compare"
+          | "print"
+
 // these are the regular expressions used by re2c
 id = [a-zA-Z_][a-zA-Z0-9_]*
 integer = [0-9]+
+float = [0-9]+ "." [0-9]+
+sized_int = [iu](8|16|32|64)
 
     \endverbatim
  */
@@ -337,6 +361,7 @@ private:
    * \verbatim
       term = conditional
            | while
+           | for
            | bind
            | affix ";"
    * \endverbatim
@@ -378,6 +403,21 @@ private:
    */
   auto ParseWhile(CompilationUnit &env) -> Result;
 
+  /**
+   * @brief Parses For expressions
+   *
+   * \verbatim
+      for = "for" id "in" affix [".." affix] {hint} "do" block
+
+      hint = ("unroll" | "vectorize") integer
+   * \endverbatim
+   *
+   * @param env The environment associated with this compilation unit
+   * @return Outcome<std::unique_ptr<Ast>, Error> if true, then the expression
+   * which was parsed. if false, then the Error which was encountered.
+   */
+  auto ParseFor(CompilationUnit &env) -> Result;
+
   /**
    * @brief Parses Affix expressions
    *
@@ -399,6 +439,17 @@ private:
    */
   auto ParseAffix(CompilationUnit &env) -> Result;
 
+  /**
+   * @brief Parses the remainder of an Affix expression, given the
+   * composite expression which was already parsed.
+   *
+   * @param composite the already parsed composite expression
+   * @param env The environment associated with this compilation unit
+   * @return Outcome<std::unique_ptr<Ast>, Error> if true, then the expression
+   * which was parsed. if false, then the Error which was encountered.
+   */
+  auto ParseAffix(Ast::Pointer composite, CompilationUnit &env) -> Result;
+
   /**
    * @brief Parses Assignment expressions
    *
@@ -444,6 +495,17 @@ private:
    */
   auto ParseComposite(CompilationUnit &env) -> Result;
 
+  /**
+   * @brief Parses the remainder of a Composite expression, given the
+   * accessor expression which was already parsed.
+   *
+   * @param accessor the already parsed accessor expression
+   * @param env The environment associated with this compilation unit
+   * @return Outcome<std::unique_ptr<Ast>, Error> if true, then the expression
+   * which was parsed. if false, then the Error which was encountered.
+   */
+  auto ParseComposite(Ast::Pointer accessor, CompilationUnit &env) -> Result;
+
   /**
    * @brief Parses builtin expressions
    *
@@ -468,6 +530,17 @@ private:
    */
   auto ParseBuiltin(CompilationUnit &env) -> Result;
 
+  /**
+   * @brief Parses the remainder of a Builtin expression, given the
+   * basic expression which was already parsed.
+   *
+   * @param basic the already parsed basic expression
+   * @param env The environment associated with this compilation unit
+   * @return Outcome<std::unique_ptr<Ast>, Error> if true, then the expression
+   * which was parsed. if false, then the Error which was encountered.
+   */
+  auto ParseBuiltin(Ast::Pointer basic, CompilationUnit &env) -> Result;
+
   /**
    * @brief Parses member access expressions
    *
@@ -518,6 +591,7 @@ private:
    * \verbatim
       basic = id [":=" affix]
             | integer
+            | float
             | operator accessor
             | "true"
             | "false"
@@ -554,23 +628,77 @@ private:
       "[" affix {"," affix} "]"
    * \endverbatim
    *
+   * an array composed entirely of integer literals is kept as
+   * a packed buffer of values, rather than as a node per element.
+   * this keeps large lookup tables cheap to parse and to emit.
+   *
    * @param env the environment associated with this compilation unit
    * @return Outcome<std::unique_ptr<Ast>, Error> if true then the expression,
    * if false then the Error which was encountered.
    */
   auto ParseArray(CompilationUnit &env) -> Result;
 
+  /**
+   * @brief Parses a Vector
+   *
+   * \verbatim
+      vector_type "(" affix {"," affix} ")"
+   * \endverbatim
+   *
+   * the arguments are either one element per lane, a single
+   * element for every lane, or an array or slice and the index
+   * of the first lane within it.
+   *
+   * @param env the environment associated with this compilation unit
+   * @return Outcome<std::unique_ptr<Ast>, Error> if true then the expression,
+   * if false then the Error which was encountered.
+   */
+  auto ParseVector(CompilationUnit &env) -> Result;
+
+  /**
+   * @brief Parses an explicit conversion between numeric types
+   *
+   * \verbatim
+      numeric_type "(" affix ")"
+   * \endverbatim
+   *
+   * @param env the environment associated with this compilation unit
+   * @return Outcome<std::unique_ptr<Ast>, Error> if true then the expression,
+   * if false then the Error which was encountered.
+   */
+  auto ParseCast(CompilationUnit &env) -> Result;
+
+  /**
+   * @brief Parses a call of an intrinsic
+   *
+   * \verbatim
+      intrinsic "(" [(type | affix) {"," affix}] ")"
+   * \endverbatim
+   *
+   * the type argument is present if and only if the intrinsic
+   * takes one, as in arena_alloc(Integer, n).
+   *
+   * @param env the environment associated with this compilation unit
+   * @return Outcome<std::unique_ptr<Ast>, Error> if true then the expression,
+   * if false then the Error which was encountered.
+   */
+  auto ParseIntrinsic(CompilationUnit &env) -> Result;
+
   /**
    * @brief Parses Type expressions
    *
    * \verbatim
       type = "Nil"
            | "Integer"
+           | [iu](8|16|32|64)
+           | "Float32"
+           | "Float64"
            | "Boolean"
            | "*" type
            | "*[]" type
            | "(" type {"," type} ")"
            | "[" type ";" int "]"
+           | "Vector" "<" type ";" int ">"
            | "fn" "(" type {"," type} ")" "->" type
    * \endverbatim
    *
@@ -580,6 +708,7 @@ private:
    */
   auto ParseType(CompilationUnit &env) -> TypeResult;
   auto ParseArrayType(CompilationUnit &env) -> TypeResult;
+  auto ParseVectorType(CompilationUnit &env) -> TypeResult;
   auto ParseTupleType(CompilationUnit &env) -> TypeResult;
   auto ParsePointerType(CompilationUnit &env) -> TypeResult;
   auto ParseFunctionType(CompilationUnit &env) -> TypeResult;
@@ -29,7 +29,6 @@ namespace pink {
  * @brief Represents an instance of a Token within the [Lexer](#pink::Lexer) and
  * [Parser](#pink::Parser)
  * 
- * \todo add a bitshift operator 
  * \todo add a divmod operator/builtin
  */
 enum class Token : unsigned {
@@ -53,8 +52,11 @@ enum class Token : unsigned {
   LessThanOrEqual,    // '<='
   GreaterThan,        // '>'
   GreaterThanOrEqual, // '>='
+  ShiftLeft,          // '<<'
+  ShiftRight,         // '>>'
 
   Dot,       // '.'
+  DotDot,    // '..'
   Comma,     // ','
   Semicolon, // ';'
   Colon,     // ':'
@@ -68,13 +70,17 @@ enum class Token : unsigned {
   RBracket,  // ']'
   RArrow,    // '->'
 
-  Nil,         // "nil"
-  NilType,     // "Nil"
-  Integer,     // [0-9]+
-  IntegerType, // "Integer"
-  True,        // "true"
-  False,       // "false"
-  BooleanType, // "Boolean"
+  Nil,              // "nil"
+  NilType,          // "Nil"
+  Integer,          // [0-9]+
+  IntegerType,      // "Integer"
+  SizedIntegerType, // [iu](8|16|32|64)
+  Float,            // [0-9]+ "." [0-9]+
+  FloatType,        // "Float32" | "Float64"
+  True,             // "true"
+  False,            // "false"
+  BooleanType,      // "Boolean"
+  VectorType,       // "Vector"
 
   Fn,    // 'fn'
   Var,   // 'var'
@@ -83,6 +89,12 @@ enum class Token : unsigned {
   Else,  // 'else'
   While, // 'while'
   Do,    // 'do'
+  For,   // 'for'
+  In,    // 'in'
+
+  Intrinsic, // "arena_alloc" | "arena_reset" | "pool_alloc" | "pool_free"
+             // | "mem_copy" | "mem_move" | "mem_fill" | "mem_compare"
+             // | "print"
 };
 
 /**
@@ -25,10 +25,20 @@
 
 namespace pink {
 class CompilationUnit;
+class VectorType;
 /**
  * @brief Initialize the [BinopTable](#BinopTable) with all predefined binops
  *
  * @param env The env holding the BinopTable to initialize
  */
 void InitializeBinopPrimitives(CompilationUnit &env);
+
+/**
+ * @brief Register the lane wise binops of the given vector type
+ *
+ * @param env The env holding the BinopTable to register within
+ * @param vector_type the vector type to register binops for
+ */
+void InitializeVectorBinopPrimitives(CompilationUnit  &env,
+                                     const VectorType *vector_type);
 } // namespace pink
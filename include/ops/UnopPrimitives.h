@@ -24,10 +24,20 @@
 
 namespace pink {
 class CompilationUnit;
+class VectorType;
 /**
  * @brief Initialize the [UnopTable](#UnopTable) with all predefined unops
  *
  * @param env the env holding the UnopTable to initialize
  */
 void InitializeUnopPrimitives(CompilationUnit &env);
+
+/**
+ * @brief Register the lane wise unops of the given vector type
+ *
+ * @param env the env holding the UnopTable to register within
+ * @param vector_type the vector type to register unops for
+ */
+void InitializeVectorUnopPrimitives(CompilationUnit  &env,
+                                    const VectorType *vector_type);
 } // namespace pink
@@ -20,11 +20,14 @@
 #include "type/ArrayType.h"
 #include "type/BoolType.h"
 #include "type/CharacterType.h"
+#include "type/FloatType.h"
 #include "type/FunctionType.h"
 #include "type/IntType.h"
 #include "type/NilType.h"
 #include "type/PointerType.h"
+#include "type/SizedIntType.h"
 #include "type/SliceType.h"
 #include "type/TupleType.h"
 #include "type/TypeVariable.h"
+#include "type/VectorType.h"
 #include "type/VoidType.h"
\ No newline at end of file
@@ -0,0 +1,82 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/**
+ * @file FloatType.h
+ * @brief Header for FloatType
+ * @version 0.1
+ */
+#pragma once
+
+#include "type/Type.h"
+
+namespace pink {
+/**
+ * @brief Represents the floating point types Float32 and Float64
+ *
+ * which are the IEEE 754 single and double precision types,
+ * 'float' and 'double' in llvm IR.
+ */
+class FloatType : public Type {
+public:
+  using Pointer = FloatType const *;
+
+private:
+  unsigned bit_width;
+
+public:
+  FloatType(TypeInterner *context,
+            Annotations   annotations,
+            unsigned      bit_width) noexcept
+      : Type(Type::Kind::Float, context, annotations),
+        bit_width(bit_width) {}
+  ~FloatType() noexcept override                                 = default;
+  FloatType(const FloatType &other) noexcept                     = default;
+  FloatType(FloatType &&other) noexcept                          = default;
+  auto operator=(const FloatType &other) noexcept -> FloatType & = default;
+  auto operator=(FloatType &&other) noexcept -> FloatType      & = default;
+
+  [[nodiscard]] auto GetBitWidth() const noexcept -> unsigned {
+    return bit_width;
+  }
+
+  static auto classof(const Type *type) noexcept -> bool {
+    return Type::Kind::Float == type->GetKind();
+  }
+
+  auto ToLLVM(CompilationUnit &unit) const noexcept -> llvm::Type * override;
+
+  auto Equals(Type::Pointer right) const noexcept -> bool override {
+    const auto *other = llvm::dyn_cast<const FloatType>(right);
+    if (other == nullptr) {
+      return false;
+    }
+    return bit_width == other->bit_width;
+  }
+
+  auto StrictEquals(Type::Pointer right) const noexcept -> bool override {
+    if (GetAnnotations() != right->GetAnnotations()) {
+      return false;
+    }
+    return Equals(right);
+  }
+
+  void Print(std::ostream &stream) const noexcept override {
+    stream << "Float" << bit_width;
+  }
+};
+} // namespace pink
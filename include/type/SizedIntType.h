@@ -0,0 +1,88 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+/**
+ * @file SizedIntType.h
+ * @brief Header for SizedIntegerType
+ * @version 0.1
+ */
+#pragma once
+
+#include "type/Type.h"
+
+namespace pink {
+/**
+ * @brief Represents the fixed width integer types i8 through u64
+ *
+ * unlike Integer, which is always 64 bits wide and signed, a sized
+ * integer carries it's width and signedness, which select the
+ * division, remainder, comparison and shift instructions used for it.
+ */
+class SizedIntegerType : public Type {
+public:
+  using Pointer = SizedIntegerType const *;
+
+private:
+  unsigned bit_width;
+  bool     is_signed;
+
+public:
+  SizedIntegerType(TypeInterner *context,
+                   Annotations   annotations,
+                   unsigned      bit_width,
+                   bool          is_signed) noexcept
+      : Type(Type::Kind::SizedInteger, context, annotations),
+        bit_width(bit_width),
+        is_signed(is_signed) {}
+  ~SizedIntegerType() noexcept override                    = default;
+  SizedIntegerType(const SizedIntegerType &other) noexcept = default;
+  SizedIntegerType(SizedIntegerType &&other) noexcept      = default;
+  auto operator=(const SizedIntegerType &other) noexcept
+      -> SizedIntegerType & = default;
+  auto operator=(SizedIntegerType &&other) noexcept
+      -> SizedIntegerType & = default;
+
+  [[nodiscard]] auto GetBitWidth() const noexcept -> unsigned {
+    return bit_width;
+  }
+  [[nodiscard]] auto IsSigned() const noexcept -> bool { return is_signed; }
+
+  static auto classof(const Type *type) noexcept -> bool {
+    return Type::Kind::SizedInteger == type->GetKind();
+  }
+
+  auto ToLLVM(CompilationUnit &unit) const noexcept -> llvm::Type * override;
+
+  auto Equals(Type::Pointer right) const noexcept -> bool override {
+    const auto *other = llvm::dyn_cast<const SizedIntegerType>(right);
+    if (other == nullptr) {
+      return false;
+    }
+    return (bit_width == other->bit_width) && (is_signed == other->is_signed);
+  }
+
+  auto StrictEquals(Type::Pointer right) const noexcept -> bool override {
+    if (GetAnnotations() != right->GetAnnotations()) {
+      return false;
+    }
+    return Equals(right);
+  }
+
+  void Print(std::ostream &stream) const noexcept override {
+    stream << (is_signed ? "i" : "u") << bit_width;
+  }
+};
+} // namespace pink
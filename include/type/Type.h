@@ -54,13 +54,16 @@ public:
     Array,
     Boolean,
     Character,
+    Float,
     Function,
     Variable,
     Integer,
+    SizedInteger,
     Nil,
     Pointer,
     Slice,
     Tuple,
+    Vector,
     Void,
   };
 
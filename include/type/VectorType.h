@@ -0,0 +1,84 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+/**
+ * @file VectorType.h
+ * @brief Header for class VectorType
+ * @version 0.1
+ */
+#pragma once
+#include "type/Type.h"
+
+namespace pink {
+/**
+ * @brief Represents the Type of a SIMD Vector
+ *
+ * a Vector<T; N> holds N lanes of the scalar type T,
+ * and is lowered to the llvm fixed vector <N x T>.
+ * operators on vectors apply to each lane.
+ */
+class VectorType : public Type {
+public:
+  using Pointer = VectorType const *;
+
+private:
+  std::size_t   length;
+  Type::Pointer element_type;
+
+public:
+  VectorType(TypeInterner *context,
+             Annotations   annotations,
+             std::size_t   length,
+             Type::Pointer element_type) noexcept
+      : Type(Type::Kind::Vector, context, annotations),
+        length(length),
+        element_type(element_type) {
+    assert(element_type != nullptr);
+  }
+  ~VectorType() noexcept override                                  = default;
+  VectorType(const VectorType &other) noexcept                     = default;
+  VectorType(VectorType &&other) noexcept                          = default;
+  auto operator=(const VectorType &other) noexcept -> VectorType & = default;
+  auto operator=(VectorType &&other) noexcept -> VectorType      & = default;
+
+  [[nodiscard]] auto GetLength() const -> std::size_t { return length; }
+  [[nodiscard]] auto GetElementType() const -> Type::Pointer {
+    return element_type;
+  }
+
+  static auto classof(const Type::Pointer type) noexcept -> bool {
+    return Type::Kind::Vector == type->GetKind();
+  }
+
+  /**
+   * @brief true if the given type may be the element type of a Vector
+   */
+  static auto IsElementType(Type::Pointer type) noexcept -> bool;
+
+  auto ToLLVM(CompilationUnit &unit) const noexcept -> llvm::Type * override;
+  auto Equals(Type::Pointer right) const noexcept -> bool override;
+
+  auto StrictEquals(Type::Pointer right) const noexcept -> bool override {
+    if (GetAnnotations() != right->GetAnnotations()) {
+      return false;
+    }
+    return Equals(right);
+  }
+
+  void Print(std::ostream &stream) const noexcept override;
+};
+} // namespace pink
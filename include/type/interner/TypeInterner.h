@@ -65,17 +65,20 @@ private:
     }
   };
 
-  Set<NilType>       nil_types;
-  Set<BooleanType>   boolean_types;
-  Set<IntegerType>   integer_types;
-  Set<CharacterType> character_types;
-  Set<VoidType>      void_types;
-  Set<FunctionType>  function_types;
-  Set<PointerType>   pointer_types;
-  Set<ArrayType>     array_types;
-  Set<SliceType>     slice_types;
-  Set<TupleType>     tuple_types;
-  Set<TypeVariable>  type_variables;
+  Set<NilType>          nil_types;
+  Set<BooleanType>      boolean_types;
+  Set<IntegerType>      integer_types;
+  Set<SizedIntegerType> sized_integer_types;
+  Set<FloatType>        float_types;
+  Set<CharacterType>    character_types;
+  Set<VoidType>         void_types;
+  Set<FunctionType>     function_types;
+  Set<PointerType>      pointer_types;
+  Set<ArrayType>        array_types;
+  Set<SliceType>        slice_types;
+  Set<TupleType>        tuple_types;
+  Set<VectorType>       vector_types;
+  Set<TypeVariable>     type_variables;
 
 public:
   TypeInterner() noexcept                                     = default;
@@ -94,6 +97,15 @@ public:
   auto GetIntType(Type::Annotations annotations) -> IntegerType::Pointer {
     return integer_types.Get(this, annotations);
   }
+  auto GetSizedIntType(Type::Annotations annotations,
+                       unsigned          bit_width,
+                       bool is_signed) -> SizedIntegerType::Pointer {
+    return sized_integer_types.Get(this, annotations, bit_width, is_signed);
+  }
+  auto GetFloatType(Type::Annotations annotations, unsigned bit_width)
+      -> FloatType::Pointer {
+    return float_types.Get(this, annotations, bit_width);
+  }
   auto GetCharacterType(Type::Annotations annotations)
       -> CharacterType::Pointer {
     return character_types.Get(this, annotations);
@@ -129,6 +141,12 @@ public:
     return tuple_types.Get(this, annotations, elements);
   }
 
+  auto GetVectorType(Type::Annotations annotations,
+                     std::size_t       length,
+                     Type::Pointer     element_type) -> VectorType::Pointer {
+    return vector_types.Get(this, annotations, length, element_type);
+  }
+
   auto GetTextType(Type::Annotations annotations, std::size_t length)
       -> ArrayType::Pointer {
     // text is the type of literal strings.
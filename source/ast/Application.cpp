@@ -155,6 +155,8 @@ auto Application::Codegen(CompilationUnit &unit) const noexcept
   // 9. 'function args' ....
   // 10. the optional function attributes list
   call->setAttributes(function->getAttributes());
+  // the calling convention of the call must match the callee
+  call->setCallingConv(function->getCallingConv());
   return call;
 }
 
@@ -35,6 +35,17 @@ when we construct an array it is a temporary value.
 */
 auto Array::Typecheck(CompilationUnit &unit) const noexcept
     -> Outcome<Type::Pointer> {
+  // #RULE a packed array is an array of integer literals
+  if (IsPacked()) {
+    Type::Annotations annotations;
+    annotations.IsInMemory(false);
+    auto array_type = unit.GetArrayType(annotations,
+                                        packed.size(),
+                                        unit.GetIntType(annotations));
+    SetCachedType(array_type);
+    return array_type;
+  }
+
   Type::Annotations          annotations;
   std::vector<Type::Pointer> element_types;
   element_types.reserve(elements.size());
@@ -85,21 +96,42 @@ auto Array::Typecheck(CompilationUnit &unit) const noexcept
 auto Array::Codegen(CompilationUnit &unit) const noexcept
     -> Outcome<llvm::Value *> {
   auto cached_type = GetCachedTypeOrAssert();
-  // #TODO if the array is composed entirely of literals
-  // create a llvm::ConstantArray instead of a stack allocation.
 
   auto *layout_type = llvm::cast<llvm::StructType>(ToLLVM(cached_type, unit));
 
   auto alloca = unit.CreateAlloca(layout_type, nullptr, "array");
 
+  // #NOTE: arrays are mutable, so a constant array is
+  // copied from a read-only global into the stack allocation.
+  if (IsPacked()) {
+    unit.StoreConstAggregate(layout_type,
+                             unit.ConstantPackedArray(packed),
+                             alloca);
+    return alloca;
+  }
+
   std::vector<llvm::Value *> actual_elements;
   actual_elements.reserve(elements.size());
+  std::vector<llvm::Constant *> constant_elements;
+  constant_elements.reserve(elements.size());
   for (auto &element : elements) {
     auto element_outcome = element->Codegen(unit);
     if (!element_outcome) {
       return element_outcome;
     }
-    actual_elements.emplace_back(element_outcome.GetFirst());
+    auto *element_value = element_outcome.GetFirst();
+    actual_elements.emplace_back(element_value);
+
+    if (auto *constant = llvm::dyn_cast<llvm::Constant>(element_value)) {
+      constant_elements.emplace_back(constant);
+    }
+  }
+
+  if (constant_elements.size() == actual_elements.size()) {
+    unit.StoreConstAggregate(layout_type,
+                             unit.ConstantArray(constant_elements),
+                             alloca);
+    return alloca;
   }
 
   unit.StoreArray(layout_type, alloca, actual_elements);
@@ -110,7 +142,16 @@ void Array::Print(std::ostream &stream) const noexcept {
   stream << "[";
 
   std::size_t index  = 0;
-  std::size_t length = elements.size();
+  std::size_t length = Size();
+  for (auto value : packed) {
+    stream << value;
+
+    if (index < (length - 1)) {
+      stream << ", ";
+    }
+    index++;
+  }
+
   for (const auto &element : elements) {
     stream << element;
 
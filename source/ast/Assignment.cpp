@@ -15,6 +15,10 @@
 // You should have received a copy of the GNU General Public License
 // along with pink.  If not, see <http://www.gnu.org/licenses/>.
 #include "ast/Assignment.h"
+#include "ast/Dot.h"
+#include "ast/Integer.h"
+#include "ast/Subscript.h"
+#include "ast/Variable.h"
 
 #include "aux/Environment.h"
 
@@ -61,6 +65,90 @@ auto Assignment::Typecheck(CompilationUnit &unit) const noexcept
   return left_type;
 }
 
+/*
+  v.n = b, v[n] = b
+
+  a lane of a vector has no address, so the lane is inserted
+  into the value of v, and v is assigned the new vector.
+
+  #NOTE: v is evaluated twice, once for it's value and once
+  for it's address. this is only observable when the
+  expression v itself has side effects.
+*/
+namespace {
+auto AssignLane(CompilationUnit &unit,
+                const Ast      *vector,
+                const Ast      *lane,
+                const Ast      *right) -> Outcome<llvm::Value *> {
+  const auto *vector_type =
+      llvm::cast<VectorType>(vector->GetCachedTypeOrAssert());
+  auto *llvm_vector_type =
+      llvm::cast<llvm::FixedVectorType>(vector_type->ToLLVM(unit));
+
+  auto vector_outcome = vector->Codegen(unit);
+  if (!vector_outcome) {
+    return vector_outcome;
+  }
+  auto *vector_value = vector_outcome.GetFirst();
+
+  llvm::Value *index = nullptr;
+  if (const auto *integer = llvm::dyn_cast<Integer>(lane);
+      integer != nullptr) {
+    index = unit.ConstantInteger(static_cast<std::size_t>(integer->GetValue()));
+  } else {
+    auto lane_outcome = lane->Codegen(unit);
+    if (!lane_outcome) {
+      return lane_outcome;
+    }
+    index = unit.LaneIndex(llvm_vector_type, lane_outcome.GetFirst());
+  }
+
+  auto right_outcome = right->Codegen(unit);
+  if (!right_outcome) {
+    return right_outcome;
+  }
+  auto *right_value = right_outcome.GetFirst();
+
+  auto *result = unit.CreateInsertElement(vector_value, right_value, index);
+
+  // #RULE assigning an SSA variable rebinds it to the new value
+  if (const auto *variable = llvm::dyn_cast<Variable>(vector);
+      variable != nullptr) {
+    auto bound = unit.LookupVariable(variable->GetSymbol());
+    assert(bound.has_value());
+    if (bound->IsSSA()) {
+      unit.AssignSSAVariable(variable->GetSymbol(), result);
+      return right_value;
+    }
+  }
+
+  unit.OnTheLHSOfAssignment(true);
+  auto destination_outcome = vector->Codegen(unit);
+  unit.OnTheLHSOfAssignment(false);
+  if (!destination_outcome) {
+    return destination_outcome;
+  }
+
+  unit.Store(llvm_vector_type, result, destination_outcome.GetFirst());
+  return right_value;
+}
+} // namespace
+
+auto Assignment::GetLane() const noexcept
+    -> std::pair<const Ast *, const Ast *> {
+  if (const auto *dot = llvm::dyn_cast<Dot>(left.get());
+      (dot != nullptr) &&
+      llvm::isa<VectorType>(dot->GetLeft()->GetCachedTypeOrAssert())) {
+    return {dot->GetLeft().get(), dot->GetRight().get()};
+  }
+  if (const auto *subscript = llvm::dyn_cast<Subscript>(left.get());
+      (subscript != nullptr) &&
+      llvm::isa<VectorType>(subscript->GetLeft()->GetCachedTypeOrAssert())) {
+    return {subscript->GetLeft().get(), subscript->GetRight().get()};
+  }
+  return {nullptr, nullptr};
+}
+
 /*
   a = b
 
@@ -70,6 +158,27 @@ auto Assignment::Typecheck(CompilationUnit &unit) const noexcept
 */
 auto Assignment::Codegen(CompilationUnit &unit) const noexcept
     -> Outcome<llvm::Value *> {
+  // #RULE assigning a lane of a vector replaces the vector
+  if (auto [vector, lane] = GetLane(); vector != nullptr) {
+    return AssignLane(unit, vector, lane, right.get());
+  }
+
+  // #RULE assigning an SSA variable rebinds it to the new value
+  if (const auto *variable = llvm::dyn_cast<Variable>(left.get());
+      variable != nullptr) {
+    auto bound = unit.LookupVariable(variable->GetSymbol());
+    assert(bound.has_value());
+    if (bound->IsSSA()) {
+      auto right_outcome = right->Codegen(unit);
+      if (!right_outcome) {
+        return right_outcome;
+      }
+      auto *right_value = right_outcome.GetFirst();
+      unit.AssignSSAVariable(variable->GetSymbol(), right_value);
+      return right_value;
+    }
+  }
+
   unit.OnTheLHSOfAssignment(true);
   auto left_outcome = left->Codegen(unit);
   if (!left_outcome) {
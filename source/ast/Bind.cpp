@@ -100,8 +100,14 @@ auto Bind::Codegen(CompilationUnit &unit) const noexcept
   // #RULE We must not allocate space for non-singleValueType()s
   // as the Codegen function for non-singleValueType() literals
   // allocates stack space for them.
+  // #RULE local variables which are never used by address
+  // are bound directly to their value, without allocating.
   auto llvm_type = ToLLVM(affix_type, unit);
   if (llvm_type->isSingleValueType()) {
+    if (unit.IsPromotable(symbol)) {
+      unit.BindSSAVariable(symbol, affix_type, affix_value);
+      return affix_value;
+    }
     affix_value = unit.AllocateVariable(symbol, llvm_type, affix_value);
   }
 
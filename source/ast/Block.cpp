@@ -16,6 +16,7 @@
 // along with pink.  If not, see <http://www.gnu.org/licenses/>.
 #include "ast/Block.h"
 #include "ast/Conditional.h"
+#include "ast/For.h"
 #include "ast/While.h"
 
 #include "aux/Environment.h"
@@ -91,7 +92,8 @@ void Block::Print(std::ostream &stream) const noexcept {
   for (const auto &expression : expressions) {
     stream << expression;
 
-    if (!llvm::isa<IfThenElse>(expression) && !llvm::isa<While>(expression)) {
+    if (!llvm::isa<IfThenElse>(expression) && !llvm::isa<While>(expression) &&
+        !llvm::isa<For>(expression)) {
       stream << "; ";
     } else {
       stream << " ";
@@ -0,0 +1,105 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+#include "ast/Cast.h"
+
+#include "aux/Environment.h"
+
+namespace pink {
+namespace {
+// #RULE Integer is signed, Boolean is unsigned, and a sized
+// integer is signed when it's name begins with 'i'. a float
+// is signed, though it's signedness is never consulted.
+auto IsSigned(Type::Pointer type) -> bool {
+  if (const auto *sized_type = llvm::dyn_cast<SizedIntegerType>(type);
+      sized_type != nullptr) {
+    return sized_type->IsSigned();
+  }
+  return llvm::isa<IntegerType>(type) || llvm::isa<FloatType>(type);
+}
+} // namespace
+
+/*
+  The type of a Cast is the target type if and only if
+  the right hand side has type Integer, Boolean, or one
+  of the sized integer or float types.
+
+  the result of a conversion is a new value, so it is
+  never in memory.
+*/
+auto Cast::Typecheck(CompilationUnit &unit) const noexcept
+    -> Outcome<Type::Pointer> {
+  auto right_outcome = right->Typecheck(unit);
+  if (!right_outcome) {
+    return right_outcome;
+  }
+  auto right_type = right_outcome.GetFirst();
+
+  if (!llvm::isa<IntegerType>(right_type) &&
+      !llvm::isa<SizedIntegerType>(right_type) &&
+      !llvm::isa<FloatType>(right_type) &&
+      !llvm::isa<BooleanType>(right_type)) {
+    std::stringstream errmsg;
+    errmsg << "Cannot convert type [";
+    errmsg << right_type;
+    errmsg << "] to type [";
+    errmsg << target;
+    errmsg << "]";
+    return Error(Error::Code::CannotCastFromType,
+                 right->GetLocation(),
+                 std::move(errmsg).str());
+  }
+
+  Type::Annotations annotations;
+  annotations.IsInMemory(false);
+  auto result_type = [&]() -> Type::Pointer {
+    if (const auto *sized_type = llvm::dyn_cast<SizedIntegerType>(target);
+        sized_type != nullptr) {
+      return unit.GetSizedIntType(annotations,
+                                  sized_type->GetBitWidth(),
+                                  sized_type->IsSigned());
+    }
+    if (const auto *float_type = llvm::dyn_cast<FloatType>(target);
+        float_type != nullptr) {
+      return unit.GetFloatType(annotations, float_type->GetBitWidth());
+    }
+    assert(llvm::isa<IntegerType>(target));
+    return unit.GetIntType(annotations);
+  }();
+  SetCachedType(result_type);
+  return result_type;
+}
+
+auto Cast::Codegen(CompilationUnit &unit) const noexcept
+    -> Outcome<llvm::Value *> {
+  auto right_outcome = right->Codegen(unit);
+  if (!right_outcome) {
+    return right_outcome;
+  }
+  auto *right_value = right_outcome.GetFirst();
+  assert(right_value != nullptr);
+
+  auto *target_type = ToLLVM(target, unit);
+  return unit.Cast(right_value,
+                   target_type,
+                   IsSigned(right->GetCachedTypeOrAssert()),
+                   IsSigned(target));
+}
+
+void Cast::Print(std::ostream &stream) const noexcept {
+  stream << target << "(" << right << ")";
+}
+} // namespace pink
@@ -109,6 +109,9 @@ auto IfThenElse::Codegen(CompilationUnit &unit) const noexcept
   auto *else_BB  = unit.CreateBasicBlock("else");
   auto *merge_BB = unit.CreateBasicBlock("merge");
 
+  // each alternative begins with the SSA variables as they are here
+  auto before = unit.SnapshotSSAVariables();
+
   unit.CreateCondBr(test_value, then_BB, else_BB);
   unit.SetInsertionPoint(then_BB);
 
@@ -120,7 +123,9 @@ auto IfThenElse::Codegen(CompilationUnit &unit) const noexcept
   assert(first_value != nullptr);
 
   unit.CreateBr(merge_BB);
-  then_BB = unit.GetInsertionPoint().block;
+  then_BB         = unit.GetInsertionPoint().block;
+  auto after_then = unit.SnapshotSSAVariables();
+  unit.RestoreSSAVariables(before);
 
   unit.InsertBasicBlock(else_BB);
   unit.SetInsertionPoint(else_BB);
@@ -133,10 +138,16 @@ auto IfThenElse::Codegen(CompilationUnit &unit) const noexcept
   assert(second_value != nullptr);
 
   unit.CreateBr(merge_BB);
-  else_BB = unit.GetInsertionPoint().block;
+  else_BB         = unit.GetInsertionPoint().block;
+  auto after_else = unit.SnapshotSSAVariables();
 
   unit.InsertBasicBlock(merge_BB);
   unit.SetInsertionPoint(merge_BB);
+  unit.MergeSSAVariables(before.size(),
+                         after_then,
+                         then_BB,
+                         after_else,
+                         else_BB);
   auto *phi = unit.CreatePHI(first_value->getType(), 2, "phi");
   phi->addIncoming(first_value, then_BB);
   phi->addIncoming(second_value, else_BB);
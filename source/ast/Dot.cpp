@@ -18,6 +18,7 @@
 #include "ast/Integer.h"
 
 #include "type/TupleType.h"
+#include "type/VectorType.h"
 
 #include "aux/Environment.h"
 
@@ -86,6 +87,39 @@ auto Dot::Typecheck(CompilationUnit &unit) const noexcept
   }
   auto left_type = left_outcome.GetFirst();
 
+  // #RULE the lanes of a vector are accessed like the
+  // elements of a tuple.
+  if (const auto *vector_type = llvm::dyn_cast<VectorType>(left_type);
+      vector_type != nullptr) {
+    auto *index = llvm::dyn_cast<Integer>(right.get());
+    if (index == nullptr) {
+      std::stringstream errmsg;
+      errmsg << "Right of dot expression [";
+      errmsg << right;
+      errmsg << "] is not an Integer literal.";
+      return Error(Error::Code::DotRightIsNotAnInt,
+                   right->GetLocation(),
+                   std::move(errmsg).str());
+    }
+
+    auto value = static_cast<std::size_t>(index->GetValue());
+    if (value >= vector_type->GetLength()) {
+      std::stringstream errmsg;
+      errmsg << "Index [";
+      errmsg << std::to_string(value);
+      errmsg << "] is larger than the highest lane [";
+      errmsg << std::to_string(vector_type->GetLength() - 1);
+      errmsg << "]";
+      return Error(Error::Code::VectorLaneOutOfRange,
+                   right->GetLocation(),
+                   std::move(errmsg).str());
+    }
+
+    auto lane_type = unit.GetLaneType(vector_type);
+    SetCachedType(lane_type);
+    return lane_type;
+  }
+
   auto tuple_type = llvm::dyn_cast<TupleType>(left_type);
   if (tuple_type == nullptr) {
     std::stringstream errmsg;
@@ -138,6 +172,13 @@ auto Dot::Codegen(CompilationUnit &unit) const noexcept
 
   auto *index = llvm::dyn_cast<Integer>(right.get());
   assert(index != nullptr);
+
+  if (llvm::isa<llvm::FixedVectorType>(left_type)) {
+    return unit.CreateExtractElement(
+        left_value,
+        unit.ConstantInteger(static_cast<std::size_t>(index->GetValue())));
+  }
+
   auto *struct_type = llvm::cast<llvm::StructType>(left_type);
   auto *gep =
       unit.CreateConstInBoundsGEP2_32(struct_type,
@@ -0,0 +1,47 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+#include "ast/Float.h"
+
+#include "aux/Environment.h"
+
+namespace pink {
+auto Float::Typecheck(CompilationUnit &unit) const noexcept
+    -> Outcome<Type::Pointer> {
+  // #RULE a float literal is never in memory
+  Type::Annotations annotations;
+  annotations.IsInMemory(false);
+  auto return_type = unit.GetFloatType(annotations, 64);
+  SetCachedType(return_type);
+  return return_type;
+}
+
+auto Float::Codegen(CompilationUnit &unit) const noexcept
+    -> Outcome<llvm::Value *> {
+  return unit.ConstantFloat(value);
+}
+
+// #NOTE: a whole number is printed with a trailing ".0",
+// such that the printed literal lexes as a Float again.
+void Float::Print(std::ostream &stream) const noexcept {
+  std::stringstream text;
+  text << value;
+  stream << text.view();
+  if (text.view().find_first_of(".e") == std::string_view::npos) {
+    stream << ".0";
+  }
+}
+} // namespace pink
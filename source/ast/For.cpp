@@ -0,0 +1,271 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+#include "ast/For.h"
+
+#include "aux/Environment.h"
+
+namespace pink {
+/*
+  The type of a For loop is Nil if and only if either
+  the bounds of the range both have type Integer, or the
+  sequence has an array or slice type, and the body
+  expression is typeable with the loop variable bound.
+
+  the loop variable has type Integer when counting over
+  a range, and the element type of the sequence otherwise.
+  it is only bound within the body of the loop.
+*/
+auto For::Typecheck(CompilationUnit &unit) const noexcept
+    -> Outcome<Type::Pointer> {
+  // #RULE we use the looser version of equality here
+  // which does not check that annotations match.
+  Type::Annotations annotations;
+  annotations.IsInMemory(false);
+  const auto *integer_type = unit.GetIntType(annotations);
+
+  auto first_outcome = first->Typecheck(unit);
+  if (!first_outcome) {
+    return first_outcome;
+  }
+  auto first_type = first_outcome.GetFirst();
+
+  auto element_outcome = [&]() -> Outcome<Type::Pointer> {
+    if (IsRange()) {
+      auto last_outcome = last->Typecheck(unit);
+      if (!last_outcome) {
+        return last_outcome;
+      }
+      auto last_type = last_outcome.GetFirst();
+
+      for (const auto &[bound, type] :
+           {std::make_pair(first.get(), first_type),
+            std::make_pair(last.get(), last_type)}) {
+        if (!Equals(type, integer_type)) {
+          std::stringstream errmsg;
+          errmsg << "Range bound has type [";
+          errmsg << type;
+          errmsg << "] expected type [Integer]";
+          return Error(Error::Code::ForRangeTypeMismatch,
+                       bound->GetLocation(),
+                       std::move(errmsg).str());
+        }
+      }
+      return integer_type;
+    }
+
+    if (const auto *array_type = llvm::dyn_cast<ArrayType>(first_type);
+        array_type != nullptr) {
+      return array_type->GetElementType();
+    }
+
+    if (const auto *slice_type = llvm::dyn_cast<SliceType>(first_type);
+        slice_type != nullptr) {
+      return slice_type->GetPointeeType();
+    }
+
+    std::stringstream errmsg;
+    errmsg << "Cannot iterate over type [";
+    errmsg << first_type;
+    errmsg << "]";
+    return Error(Error::Code::ForSequenceNotIterable,
+                 first->GetLocation(),
+                 std::move(errmsg).str());
+  }();
+  if (!element_outcome) {
+    return element_outcome;
+  }
+
+  unit.PushScope();
+  unit.BindVariable(symbol, element_outcome.GetFirst(), nullptr);
+  auto body_outcome = body->Typecheck(unit);
+  unit.PopScope();
+  if (!body_outcome) {
+    return body_outcome;
+  }
+
+  // Nil literals are never in memory
+  const auto *result_type = unit.GetNilType(annotations);
+  SetCachedType(result_type);
+  return result_type;
+}
+
+/*
+  A For loop is lowered to a counted loop,
+
+  preheader:
+    evaluate the bounds, or the sequence, once
+    br header
+  header:
+    %index = phi [lower, preheader], [%next, latch]
+    br (%index < upper), body, end
+  body:
+    bind the loop variable to %index, or the element at %index
+    ...
+    br latch
+  latch:
+    %next = add nsw %index, 1
+    br header, !llvm.loop
+  end:
+
+  the trip count of an array is it's static size, and the trip
+  count of a slice is checked against it's size once in the
+  preheader. so unlike a While loop walking a sequence by way
+  of Subscript no element access is bounds checked, which leaves
+  the loop in the form the LoopVectorizer recognizes.
+*/
+auto For::Codegen(CompilationUnit &unit) const noexcept
+    -> Outcome<llvm::Value *> {
+  auto *index_type = unit.LLVMIntegerType();
+
+  auto first_outcome = first->Codegen(unit);
+  if (!first_outcome) {
+    return first_outcome;
+  }
+  auto *first_value = first_outcome.GetFirst();
+  assert(first_value != nullptr);
+
+  llvm::Value  *lower        = nullptr;
+  llvm::Value  *upper        = nullptr;
+  Type::Pointer element_type = nullptr;
+  // the first element of the sequence, nullptr for a range
+  llvm::Value  *buffer       = nullptr;
+
+  if (IsRange()) {
+    auto last_outcome = last->Codegen(unit);
+    if (!last_outcome) {
+      return last_outcome;
+    }
+    lower        = first_value;
+    upper        = last_outcome.GetFirst();
+    element_type = first->GetCachedTypeOrAssert();
+    assert(upper != nullptr);
+  } else if (const auto *array_type =
+                 llvm::dyn_cast<ArrayType const>(
+                     first->GetCachedTypeOrAssert());
+             array_type != nullptr) {
+    auto *llvm_array_type =
+        llvm::cast<llvm::StructType>(array_type->ToLLVM(unit));
+    buffer       = unit.ArrayBuffer(llvm_array_type, first_value);
+    lower        = unit.ConstantInteger(0);
+    upper        = unit.ConstantInteger(array_type->GetSize());
+    element_type = array_type->GetElementType();
+  } else {
+    const auto *slice_type =
+        llvm::cast<SliceType const>(first->GetCachedTypeOrAssert());
+    auto *llvm_slice_type =
+        llvm::cast<llvm::StructType>(slice_type->ToLLVM(unit));
+    auto [size, offset, pointer] =
+        unit.LoadSlice(llvm_slice_type, first_value);
+    // #NOTE: the single range check of the loop, (0 <= offset <= size),
+    // every index below (size - offset) is then in bounds.
+    unit.BoundsCheck(unit.CreateAdd(size, unit.ConstantSize(1)), offset);
+    buffer       = pointer;
+    lower        = unit.ConstantInteger(0);
+    upper        = unit.CreateSub(size, offset, "trip_count");
+    element_type = slice_type->GetPointeeType();
+  }
+
+  auto *header_BB = unit.CreateAndInsertBasicBlock("header");
+  auto *body_BB   = unit.CreateBasicBlock("body");
+  auto *latch_BB  = unit.CreateBasicBlock("latch");
+  auto *end_BB    = unit.CreateBasicBlock("end");
+
+  auto *preheader_BB = unit.GetInsertionPoint().block;
+  unit.CreateBr(header_BB);
+
+  unit.SetInsertionPoint(header_BB);
+  auto *index = unit.CreatePHI(index_type, 2, "index");
+  index->addIncoming(lower, preheader_BB);
+  auto loop = unit.BeginSSALoop(preheader_BB);
+  unit.CreateCondBr(unit.CreateICmpSLT(index, upper), body_BB, end_BB);
+  // the loop is exited with the values the SSA variables
+  // have on entry to the header.
+  auto exit = unit.SnapshotSSAVariables();
+
+  unit.SetInsertionPoint(body_BB);
+  unit.InsertBasicBlock(body_BB);
+  // #NOTE: the loop variable is only bound within the body,
+  // so it gets it's own scope, unlike the bindings of a Block.
+  unit.PushScope();
+  auto        *llvm_element_type = ToLLVM(element_type, unit);
+  llvm::Value *element           = index;
+  if (buffer != nullptr) {
+    auto *address =
+        unit.CreateInBoundsGEP(llvm_element_type, buffer, {index});
+    element = unit.Load(llvm_element_type, address);
+  }
+
+  // #NOTE: aggregate elements are bound by address, as
+  // a Bind of an aggregate is bound to it's memory.
+  if (!llvm_element_type->isSingleValueType()) {
+    unit.BindVariable(symbol, element_type, element);
+  } else if (unit.IsPromotable(symbol)) {
+    unit.BindSSAVariable(symbol, element_type, element);
+  } else {
+    // #NOTE: the variable is allocated in the entry block,
+    // and stored to on each iteration.
+    auto *variable = unit.AllocateLocal(symbol, llvm_element_type);
+    unit.Store(llvm_element_type, element, variable);
+    unit.BindVariable(symbol, element_type, variable);
+  }
+
+  auto body_outcome = body->Codegen(unit);
+  if (!body_outcome) {
+    unit.PopScope();
+    return body_outcome;
+  }
+  unit.CreateBr(latch_BB);
+
+  unit.SetInsertionPoint(latch_BB);
+  unit.InsertBasicBlock(latch_BB);
+  auto *next = unit.CreateAdd(index,
+                              unit.ConstantInteger(1),
+                              "next",
+                              /* no_unsigned_wrap */ false,
+                              /* no_signed_wrap */ true);
+  index->addIncoming(next, latch_BB);
+  auto *backedge = unit.CreateBr(header_BB);
+  backedge->setMetadata(llvm::LLVMContext::MD_loop,
+                        unit.LoopMetadata(hints.unroll, hints.vectorize));
+  // #NOTE: the scope of the loop variable is popped before the
+  // loop is closed, so the loop variable does not stand in as
+  // the latch value of an outer variable it shadows. only the
+  // variables carried around the loop stay bound, the loop
+  // variable and those bound within the body leave with the scope.
+  unit.PopScope();
+  unit.EndSSALoop(loop, latch_BB, std::move(exit));
+
+  unit.SetInsertionPoint(end_BB);
+  unit.InsertBasicBlock(end_BB);
+
+  return unit.ConstantBoolean(false);
+}
+
+void For::Print(std::ostream &stream) const noexcept {
+  stream << "for " << symbol << " in " << first;
+  if (IsRange()) {
+    stream << " .. " << last;
+  }
+  if (hints.unroll != 0) {
+    stream << " unroll " << hints.unroll;
+  }
+  if (hints.vectorize != 0) {
+    stream << " vectorize " << hints.vectorize;
+  }
+  stream << " do " << body;
+}
+} // namespace pink
@@ -15,6 +15,7 @@
 // You should have received a copy of the GNU General Public License
 // along with pink.  If not, see <http://www.gnu.org/licenses/>.
 #include "ast/Function.h"
+#include "ast/visitor/PromotableVariables.h"
 
 #include "aux/Environment.h"
 
@@ -55,6 +56,16 @@ that type.
 */
 auto Function::Typecheck(CompilationUnit &unit) const noexcept
     -> Outcome<Type::Pointer> {
+  // #RULE a function cannot take the name of a memory routine,
+  // as the code llvm generates calls them by name.
+  if (CompilationUnit::IsMemorySymbol(name)) {
+    std::stringstream errmsg;
+    errmsg << "[" << name << "] is reserved for the memory runtime";
+    return Error(Error::Code::NameAlreadyBoundInScope,
+                 GetLocation(),
+                 std::move(errmsg).str());
+  }
+
   unit.PushScope();
 
   std::vector<Type::Pointer> argument_types;
@@ -115,17 +126,27 @@ auto Function::Codegen(CompilationUnit &unit) const noexcept
     return llvm::cast<llvm::FunctionType>(pink_function_type->ToLLVM(unit));
   }();
 
-  auto *llvm_function = unit.CreateFunction(llvm_function_type,
-                                            llvm::Function::ExternalLinkage,
-                                            name);
+  // #RULE only external functions can be called from outside of
+  // the module, so every other function may use the fast calling
+  // convention, and may be removed once it is inlined.
+  auto  is_external   = unit.IsExternal(name);
+  auto *llvm_function = unit.CreateFunction(
+      llvm_function_type,
+      is_external ? llvm::Function::ExternalLinkage
+                  : llvm::Function::InternalLinkage,
+      name);
 
   llvm_function->setAttributes(attributes);
+  if (!is_external) {
+    llvm_function->setCallingConv(llvm::CallingConv::Fast);
+  }
 
   auto *entry_BB = unit.CreateAndInsertBasicBlock(name + std::string("_entry"));
   unit.SetInsertionPoint(entry_BB);
   unit.PushScope();
 
   unit.ConstructFunctionArguments(llvm_function, this);
+  unit.SetPromotableVariables(PromotableVariables::Compute(body.get()));
 
   auto body_outcome = body->Codegen(unit);
   if (!body_outcome) {
@@ -147,7 +168,7 @@ auto Function::Codegen(CompilationUnit &unit) const noexcept
 
   std::string              buffer;
   llvm::raw_string_ostream out(buffer);
-  if (llvm::verifyFunction(*llvm_function, &out)) {
+  if (unit.DoVerify() && llvm::verifyFunction(*llvm_function, &out)) {
     out << " llvm function [\n"
         << LLVMValueToString(llvm_function) << "]\n"
         << "llvm type [" << LLVMTypeToString(llvm_function_type) << "]\n"
@@ -0,0 +1,414 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+#include "ast/Intrinsic.h"
+
+#include "aux/Environment.h"
+
+namespace pink {
+namespace {
+// the element type of an array or slice type, nullptr otherwise
+auto ElementType(Type::Pointer type) -> Type::Pointer {
+  if (const auto *array_type = llvm::dyn_cast<ArrayType>(type);
+      array_type != nullptr) {
+    return array_type->GetElementType();
+  }
+  if (const auto *slice_type = llvm::dyn_cast<SliceType>(type);
+      slice_type != nullptr) {
+    return slice_type->GetPointeeType();
+  }
+  return nullptr;
+}
+
+// the length and first element of an array or slice.
+auto LoadSequence(CompilationUnit &unit,
+                  Type::Pointer    type,
+                  llvm::Value     *value)
+    -> std::pair<llvm::Value *, llvm::Value *> {
+  if (const auto *array_type = llvm::dyn_cast<ArrayType const>(type);
+      array_type != nullptr) {
+    auto *llvm_array_type =
+        llvm::cast<llvm::StructType>(array_type->ToLLVM(unit));
+    return {unit.ConstantInteger(array_type->GetSize()),
+            unit.ArrayBuffer(llvm_array_type, value)};
+  }
+
+  const auto *slice_type = llvm::cast<SliceType const>(type);
+  auto       *llvm_slice_type =
+      llvm::cast<llvm::StructType>(slice_type->ToLLVM(unit));
+  auto [size, offset, pointer] = unit.LoadSlice(llvm_slice_type, value);
+  // (0 <= offset <= size), so the length is never negative
+  unit.BoundsCheck(unit.CreateAdd(size, unit.ConstantSize(1)), offset);
+  return {unit.CreateSub(size, offset, "length"), pointer};
+}
+} // namespace
+
+auto Intrinsic::Lookup(std::string_view name) noexcept -> std::optional<Op> {
+  for (auto op : {Op::ArenaAlloc,
+                  Op::ArenaReset,
+                  Op::PoolAlloc,
+                  Op::PoolFree,
+                  Op::MemCopy,
+                  Op::MemMove,
+                  Op::MemFill,
+                  Op::MemCompare,
+                  Op::Print}) {
+    if (name == ToString(op)) {
+      return op;
+    }
+  }
+  return std::nullopt;
+}
+
+auto Intrinsic::ToString(Op op) noexcept -> std::string_view {
+  switch (op) {
+  case Op::ArenaAlloc:
+    return "arena_alloc";
+  case Op::ArenaReset:
+    return "arena_reset";
+  case Op::PoolAlloc:
+    return "pool_alloc";
+  case Op::PoolFree:
+    return "pool_free";
+  case Op::MemCopy:
+    return "mem_copy";
+  case Op::MemMove:
+    return "mem_move";
+  case Op::MemFill:
+    return "mem_fill";
+  case Op::MemCompare:
+    return "mem_compare";
+  case Op::Print:
+    return "print";
+  }
+  assert(false);
+  return "";
+}
+
+auto Intrinsic::TakesType(Op op) noexcept -> bool {
+  return (op == Op::ArenaAlloc) || (op == Op::PoolAlloc);
+}
+
+/*
+  The type of an Intrinsic is,
+    arena_alloc(T, n), pool_alloc(T, n) -> *[]T
+      if and only if n has type Integer.
+    arena_reset() -> Nil
+    pool_free(s) -> Nil
+      if and only if s has a slice type.
+    mem_copy(d, s), mem_move(d, s) -> Nil
+      if and only if d and s are arrays or slices
+      of the same element type.
+    mem_fill(d, x) -> Nil
+      if and only if d is an array or slice, and x
+      has it's element type.
+    mem_compare(a, b) -> Boolean
+      if and only if a and b are arrays or slices
+      of the same element type.
+    print(s) -> Nil
+      if and only if s is an array or slice of u8.
+
+  an allocation is a new slice, which is in memory
+  like any other slice.
+*/
+auto Intrinsic::Typecheck(CompilationUnit &unit) const noexcept
+    -> Outcome<Type::Pointer> {
+  std::vector<Type::Pointer> argument_types;
+  argument_types.reserve(arguments.size());
+  for (const auto &argument : arguments) {
+    auto argument_outcome = argument->Typecheck(unit);
+    if (!argument_outcome) {
+      return argument_outcome;
+    }
+    argument_types.emplace_back(argument_outcome.GetFirst());
+  }
+
+  std::size_t expected_count = [this]() -> std::size_t {
+    switch (op) {
+    case Op::ArenaReset:
+      return 0;
+    case Op::ArenaAlloc:
+    case Op::PoolAlloc:
+    case Op::PoolFree:
+    case Op::Print:
+      return 1;
+    default:
+      return 2;
+    }
+  }();
+  if (argument_types.size() != expected_count) {
+    std::stringstream errmsg;
+    errmsg << "Intrinsic [" << ToString(op) << "] takes [" << expected_count;
+    errmsg << "] arguments; [" << argument_types.size();
+    errmsg << "] arguments were provided.";
+    return Error(Error::Code::ArgNumMismatch,
+                 GetLocation(),
+                 std::move(errmsg).str());
+  }
+
+  // #RULE we use the looser version of equality here
+  // which does not check that annotations match.
+  Type::Annotations annotations;
+  annotations.IsInMemory(false);
+
+  auto ArgumentMismatch = [&](std::size_t index, std::string_view expected) {
+    std::stringstream errmsg;
+    errmsg << "Intrinsic [" << ToString(op) << "] expects " << expected;
+    errmsg << ", Actual argument type [";
+    errmsg << argument_types[index];
+    errmsg << "]";
+    return Error(Error::Code::ArgTypeMismatch,
+                 arguments[index]->GetLocation(),
+                 std::move(errmsg).str());
+  };
+
+  auto result_outcome = [&]() -> Outcome<Type::Pointer> {
+    switch (op) {
+    case Op::ArenaAlloc:
+    case Op::PoolAlloc: {
+      if (!Equals(argument_types[0], unit.GetIntType(annotations))) {
+        return ArgumentMismatch(0, "an [Integer] count");
+      }
+      Type::Annotations slice_annotations;
+      slice_annotations.IsInMemory(true);
+      return unit.GetSliceType(slice_annotations, type_argument);
+    }
+
+    case Op::PoolFree: {
+      if (!llvm::isa<SliceType>(argument_types[0])) {
+        return ArgumentMismatch(0, "a slice");
+      }
+      return unit.GetNilType(annotations);
+    }
+
+    case Op::ArenaReset: {
+      return unit.GetNilType(annotations);
+    }
+
+    case Op::Print: {
+      const auto *byte_type =
+          llvm::dyn_cast_or_null<SizedIntegerType>(
+              ElementType(argument_types[0]));
+      if ((byte_type == nullptr) || (byte_type->GetBitWidth() != 8) ||
+          byte_type->IsSigned()) {
+        return ArgumentMismatch(0, "an array or a slice of [u8]");
+      }
+      return unit.GetNilType(annotations);
+    }
+
+    case Op::MemCopy:
+    case Op::MemMove:
+    case Op::MemFill:
+    case Op::MemCompare: {
+      auto element_type = ElementType(argument_types[0]);
+      if (element_type == nullptr) {
+        return ArgumentMismatch(0, "an array or a slice");
+      }
+
+      if (op == Op::MemFill) {
+        if (!Equals(argument_types[1], element_type)) {
+          std::stringstream expected;
+          expected << "an element of type [" << element_type << "]";
+          return ArgumentMismatch(1, expected.str());
+        }
+        return unit.GetNilType(annotations);
+      }
+
+      auto other_type = ElementType(argument_types[1]);
+      if ((other_type == nullptr) || !Equals(other_type, element_type)) {
+        std::stringstream expected;
+        expected << "an array or a slice of [" << element_type << "]";
+        return ArgumentMismatch(1, expected.str());
+      }
+
+      if (op == Op::MemCompare) {
+        return unit.GetBoolType(annotations);
+      }
+      return unit.GetNilType(annotations);
+    }
+    }
+    assert(false);
+    return unit.GetNilType(annotations);
+  }();
+  if (!result_outcome) {
+    return result_outcome;
+  }
+
+  const auto *result_type = result_outcome.GetFirst();
+  SetCachedType(result_type);
+  return result_type;
+}
+
+/*
+  an allocation is lowered to a call of the heap runtime,
+  and a new slice {n, 0, buffer} holding the result.
+
+  pool_free(s) returns the buffer of s to the pool, and
+  leaves s empty, with a null buffer. so any later access
+  of s fails it's bounds check, and freeing s again does
+  nothing.
+
+  #NOTE: pool_free of a slice which was not returned by
+  pool_alloc is undefined.
+
+  the memory operations check the lengths of their arguments
+  once, and are then lowered to llvm.memcpy, llvm.memmove,
+  llvm.memset, or a call of bcmp. so the copy runs over the
+  whole buffer, rather than one checked element at a time.
+    mem_copy(d, s), mem_move(d, s)
+      the length of s is at most the length of d, and the
+      elements of d past the length of s are unchanged.
+    mem_compare(a, b)
+      is false when the lengths differ, and compares the
+      representation of the elements otherwise.
+
+  #NOTE: mem_copy of overlapping arguments is undefined,
+  mem_move is well defined for any arguments.
+
+  print(s) is a write of the bytes of s through the output
+  runtime, so it is buffered along with every other write
+  to stdout.
+*/
+auto Intrinsic::Codegen(CompilationUnit &unit) const noexcept
+    -> Outcome<llvm::Value *> {
+  std::vector<llvm::Value *> values;
+  values.reserve(arguments.size());
+  for (const auto &argument : arguments) {
+    auto argument_outcome = argument->Codegen(unit);
+    if (!argument_outcome) {
+      return argument_outcome;
+    }
+    assert(argument_outcome.GetFirst() != nullptr);
+    values.emplace_back(argument_outcome.GetFirst());
+  }
+
+  switch (op) {
+  case Op::ArenaAlloc:
+  case Op::PoolAlloc: {
+    auto *element_type = ToLLVM(type_argument, unit);
+    auto *count        = values[0];
+    auto *buffer       = (op == Op::ArenaAlloc)
+                             ? unit.ArenaAllocate(element_type, count)
+                             : unit.PoolAllocate(element_type, count);
+    auto *slice_type   = unit.LLVMSliceType();
+    auto *slice        = unit.AllocateLocal("slice", slice_type);
+    unit.StoreSlice(slice_type, slice, count, unit.ConstantSize(0), buffer);
+    return slice;
+  }
+
+  case Op::PoolFree: {
+    const auto *slice_type =
+        llvm::cast<SliceType const>(arguments[0]->GetCachedTypeOrAssert());
+    auto *element_type    = ToLLVM(slice_type->GetPointeeType(), unit);
+    auto *llvm_slice_type = unit.LLVMSliceType();
+    auto [size, offset, buffer] = unit.LoadSlice(llvm_slice_type, values[0]);
+    unit.PoolFree(element_type, buffer, size);
+    auto *null = llvm::ConstantPointerNull::get(unit.LLVMPointerType());
+    unit.StoreSlice(llvm_slice_type,
+                    values[0],
+                    unit.ConstantSize(0),
+                    unit.ConstantSize(0),
+                    null);
+    return unit.ConstantBoolean(false);
+  }
+
+  case Op::ArenaReset: {
+    unit.ArenaReset();
+    return unit.ConstantBoolean(false);
+  }
+
+  case Op::Print: {
+    auto [length, buffer] =
+        LoadSequence(unit, arguments[0]->GetCachedTypeOrAssert(), values[0]);
+    unit.RuntimeWrite(unit.ConstantInteger(1), length, buffer);
+    return unit.ConstantBoolean(false);
+  }
+
+  case Op::MemCopy:
+  case Op::MemMove:
+  case Op::MemFill:
+  case Op::MemCompare: {
+    auto first_type   = arguments[0]->GetCachedTypeOrAssert();
+    auto element_type = ToLLVM(ElementType(first_type), unit);
+    auto [first_length, first_buffer] =
+        LoadSequence(unit, first_type, values[0]);
+
+    if (op == Op::MemFill) {
+      unit.FillElements(element_type, first_buffer, values[1], first_length);
+      return unit.ConstantBoolean(false);
+    }
+
+    auto second_type = arguments[1]->GetCachedTypeOrAssert();
+    auto [second_length, second_buffer] =
+        LoadSequence(unit, second_type, values[1]);
+
+    if (op == Op::MemCompare) {
+      // #NOTE: sequences of differing lengths compare no elements
+      auto *same_length = unit.CreateICmpEQ(first_length, second_length);
+      auto *count       = unit.CreateSelect(same_length,
+                                            first_length,
+                                            unit.ConstantSize(0));
+      auto *same_elements = unit.CompareElements(element_type,
+                                                 first_buffer,
+                                                 second_buffer,
+                                                 count);
+      return unit.CreateAnd(same_length, same_elements);
+    }
+
+    // (second_length <= first_length)
+    unit.BoundsCheck(unit.CreateAdd(first_length, unit.ConstantSize(1)),
+                     second_length);
+    if (op == Op::MemCopy) {
+      unit.CopyElements(element_type,
+                        first_buffer,
+                        second_buffer,
+                        second_length);
+    } else {
+      unit.MoveElements(element_type,
+                        first_buffer,
+                        second_buffer,
+                        second_length);
+    }
+    return unit.ConstantBoolean(false);
+  }
+  }
+  assert(false);
+  return unit.ConstantBoolean(false);
+}
+
+void Intrinsic::Print(std::ostream &stream) const noexcept {
+  stream << ToString(op) << "(";
+  if (type_argument != nullptr) {
+    stream << type_argument;
+    if (!arguments.empty()) {
+      stream << ", ";
+    }
+  }
+
+  std::size_t index  = 0;
+  std::size_t length = arguments.size();
+  for (const auto &argument : arguments) {
+    stream << argument;
+
+    if (index < (length - 1)) {
+      stream << ", ";
+    }
+    index++;
+  }
+
+  stream << ")";
+}
+} // namespace pink
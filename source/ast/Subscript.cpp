@@ -25,6 +25,9 @@ subscriptable pointer being accessed if and only if the left
 expression has slice or array type, and the right expression
 has Integer type.
 
+the left may also have a vector type, in which case the
+type is that of a single lane, which is never in memory.
+
 the lhs of a subscript can be a literal or in memory, it can
 be constant or mutable, and it can be temporary or not.
 the rhs of a subscript can be a literal or in memory, it can
@@ -82,6 +85,11 @@ auto Subscript::Typecheck(CompilationUnit &unit) const noexcept
       return slice_type->GetPointeeType();
     }
 
+    if (const auto *vector_type = llvm::dyn_cast<VectorType>(left_type);
+        vector_type != nullptr) {
+      return unit.GetLaneType(vector_type);
+    }
+
     std::stringstream errmsg;
     errmsg << "Cannot subscript type [";
     errmsg << left_type;
@@ -144,6 +152,15 @@ auto Subscript::Codegen(CompilationUnit &unit) const noexcept
                                right_value);
   }
 
+  if (const auto *vector_type = llvm::dyn_cast<VectorType const>(left_type);
+      vector_type != nullptr) {
+    auto *llvm_vector_type =
+        llvm::cast<llvm::FixedVectorType>(vector_type->ToLLVM(unit));
+    return unit.CreateExtractElement(
+        left_value,
+        unit.LaneIndex(llvm_vector_type, right_value));
+  }
+
   // we should never reach here, just in case
   assert(false);
 }
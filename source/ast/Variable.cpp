@@ -50,6 +50,10 @@ auto Variable::Codegen(CompilationUnit &unit) const noexcept
   auto bound = unit.LookupVariable(symbol);
   assert(bound.has_value());
   assert(bound->Value() != nullptr);
+  // #RULE SSA variables are bound to their value, not their address
+  if (bound->IsSSA()) {
+    return bound->Value();
+  }
   return unit.Load(ToLLVM(bound->Type(), unit), bound->Value());
 }
 
@@ -0,0 +1,236 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+#include "ast/Vector.h"
+
+#include "aux/Environment.h"
+
+namespace pink {
+auto Vector::IsLoad() const noexcept -> bool {
+  if (arguments.size() != 2) {
+    return false;
+  }
+  auto sequence_type = arguments[0]->GetCachedTypeOrAssert();
+  return llvm::isa<ArrayType>(sequence_type) ||
+         llvm::isa<SliceType>(sequence_type);
+}
+
+/*
+  The type of a Vector is it's VectorType if and only if
+  either each argument has the element type of the vector,
+  and there is one argument or one argument per lane, or
+  the first argument is an array or slice of the element type
+  and the second argument has type Integer.
+
+  a vector built from it's lanes is a literal, a vector loaded
+  from an array or slice is in memory, such that it can appear
+  on the left of an assignment.
+
+  #NOTE: Boolean vectors are never loaded from memory, as
+  the lanes of <N x i1> are packed bits while the elements
+  of an array of Boolean are each a byte.
+*/
+auto Vector::Typecheck(CompilationUnit &unit) const noexcept
+    -> Outcome<Type::Pointer> {
+  auto        length       = vector_type->GetLength();
+  const auto *element_type = vector_type->GetElementType();
+
+  std::vector<Type::Pointer> argument_types;
+  argument_types.reserve(arguments.size());
+  for (const auto &argument : arguments) {
+    auto argument_outcome = argument->Typecheck(unit);
+    if (!argument_outcome) {
+      return argument_outcome;
+    }
+    argument_types.emplace_back(argument_outcome.GetFirst());
+  }
+
+  // #RULE we use the looser version of equality here
+  // which does not check that annotations match.
+  Type::Annotations annotations;
+  annotations.IsInMemory(false);
+
+  auto is_element = [element_type](Type::Pointer type) {
+    return Equals(type, element_type);
+  };
+  if (((argument_types.size() == 1) || (argument_types.size() == length)) &&
+      std::all_of(argument_types.begin(), argument_types.end(), is_element)) {
+    const auto *result_type =
+        unit.GetVectorType(annotations, length, element_type);
+    SetCachedType(result_type);
+    return result_type;
+  }
+
+  if ((argument_types.size() == 2) &&
+      !llvm::isa<BooleanType>(element_type) &&
+      Equals(argument_types[1], unit.GetIntType(annotations))) {
+    auto sequence_element = [&]() -> Type::Pointer {
+      if (const auto *array_type = llvm::dyn_cast<ArrayType>(argument_types[0]);
+          array_type != nullptr) {
+        return array_type->GetElementType();
+      }
+      if (const auto *slice_type = llvm::dyn_cast<SliceType>(argument_types[0]);
+          slice_type != nullptr) {
+        return slice_type->GetPointeeType();
+      }
+      return nullptr;
+    }();
+
+    if ((sequence_element != nullptr) &&
+        Equals(sequence_element, element_type)) {
+      // #RULE the lanes of a vector must fit within an array
+      if (const auto *array_type = llvm::dyn_cast<ArrayType>(argument_types[0]);
+          (array_type != nullptr) && (array_type->GetSize() < length)) {
+        std::stringstream errmsg;
+        errmsg << "Cannot load [";
+        errmsg << length;
+        errmsg << "] lanes from type [";
+        errmsg << argument_types[0];
+        errmsg << "]";
+        return Error(Error::Code::VectorLaneOutOfRange,
+                     arguments[0]->GetLocation(),
+                     std::move(errmsg).str());
+      }
+
+      annotations.IsInMemory(true);
+      const auto *result_type =
+          unit.GetVectorType(annotations, length, element_type);
+      SetCachedType(result_type);
+      return result_type;
+    }
+  }
+
+  std::stringstream errmsg;
+  errmsg << "Cannot construct type [";
+  errmsg << vector_type;
+  errmsg << "] from arguments of type (";
+  std::size_t index = 0;
+  for (auto type : argument_types) {
+    errmsg << type;
+    if (index < (argument_types.size() - 1)) {
+      errmsg << ", ";
+    }
+    index++;
+  }
+  errmsg << ")";
+  return Error(Error::Code::VectorArgumentMismatch,
+               GetLocation(),
+               std::move(errmsg).str());
+}
+
+/*
+  a vector of it's lanes is built by inserting each lane
+  into a poison vector, which folds to a constant vector
+  when each lane is a constant. a vector of a single value
+  is a splat of that value.
+
+  a vector loaded from an array or slice is a single load
+  of N lanes, or the address of the first lane when on the
+  left of an assignment or within an address of expression.
+*/
+auto Vector::Codegen(CompilationUnit &unit) const noexcept
+    -> Outcome<llvm::Value *> {
+  auto  length = vector_type->GetLength();
+  auto *llvm_vector_type =
+      llvm::cast<llvm::FixedVectorType>(vector_type->ToLLVM(unit));
+
+  if (IsLoad()) {
+    // #NOTE: the sequence and the index are always read by
+    // value, the flags only decide if the lanes are loaded.
+    auto on_the_lhs     = unit.OnTheLHSOfAssignment();
+    auto within_address = unit.WithinAddressOf();
+    unit.OnTheLHSOfAssignment(false);
+    unit.WithinAddressOf(false);
+
+    auto lanes_outcome = [&]() -> Outcome<llvm::Value *> {
+      auto sequence_outcome = arguments[0]->Codegen(unit);
+      if (!sequence_outcome) {
+        return sequence_outcome;
+      }
+      auto *sequence = sequence_outcome.GetFirst();
+
+      auto index_outcome = arguments[1]->Codegen(unit);
+      if (!index_outcome) {
+        return index_outcome;
+      }
+      auto *index = index_outcome.GetFirst();
+
+      auto sequence_type = arguments[0]->GetCachedTypeOrAssert();
+      if (const auto *array_type = llvm::dyn_cast<ArrayType>(sequence_type);
+          array_type != nullptr) {
+        auto *llvm_array_type =
+            llvm::cast<llvm::StructType>(array_type->ToLLVM(unit));
+        return unit.PtrToArrayLanes(llvm_array_type, sequence, index, length);
+      }
+
+      const auto *slice_type  = llvm::cast<SliceType>(sequence_type);
+      auto *llvm_slice_type =
+          llvm::cast<llvm::StructType>(slice_type->ToLLVM(unit));
+      return unit.PtrToSliceLanes(llvm_slice_type,
+                                  llvm_vector_type->getElementType(),
+                                  sequence,
+                                  index,
+                                  length);
+    }();
+
+    unit.OnTheLHSOfAssignment(on_the_lhs);
+    unit.WithinAddressOf(within_address);
+    if (!lanes_outcome) {
+      return lanes_outcome;
+    }
+    return unit.Load(llvm_vector_type, lanes_outcome.GetFirst());
+  }
+
+  std::vector<llvm::Value *> values;
+  values.reserve(arguments.size());
+  for (const auto &argument : arguments) {
+    auto argument_outcome = argument->Codegen(unit);
+    if (!argument_outcome) {
+      return argument_outcome;
+    }
+    values.emplace_back(argument_outcome.GetFirst());
+  }
+
+  if (values.size() == 1) {
+    return unit.CreateVectorSplat(length, values[0]);
+  }
+
+  llvm::Value *vector = llvm::PoisonValue::get(llvm_vector_type);
+  for (std::size_t index = 0; index < length; ++index) {
+    vector = unit.CreateInsertElement(vector,
+                                      values[index],
+                                      unit.ConstantInteger(index));
+  }
+  return vector;
+}
+
+void Vector::Print(std::ostream &stream) const noexcept {
+  stream << vector_type << "(";
+
+  std::size_t index  = 0;
+  std::size_t length = arguments.size();
+  for (const auto &argument : arguments) {
+    stream << argument;
+
+    if (index < (length - 1)) {
+      stream << ", ";
+    }
+    index++;
+  }
+
+  stream << ")";
+}
+} // namespace pink
@@ -70,9 +70,11 @@ auto While::Codegen(CompilationUnit &unit) const noexcept
   auto *body_BB = unit.CreateBasicBlock("body");
   auto *end_BB  = unit.CreateBasicBlock("end");
 
+  auto *preheader_BB = unit.GetInsertionPoint().block;
   unit.CreateBr(test_BB);
 
   unit.SetInsertionPoint(test_BB);
+  auto loop         = unit.BeginSSALoop(preheader_BB);
   auto test_outcome = test->Codegen(unit);
   if (!test_outcome) {
     return test_outcome;
@@ -80,6 +82,9 @@ auto While::Codegen(CompilationUnit &unit) const noexcept
   auto *test_value = test_outcome.GetFirst();
   assert(test_value != nullptr);
   unit.CreateCondBr(test_value, body_BB, end_BB);
+  // the loop is exited with the values the SSA variables
+  // have after the test expression.
+  auto exit = unit.SnapshotSSAVariables();
 
   unit.SetInsertionPoint(body_BB);
   unit.InsertBasicBlock(body_BB);
@@ -90,6 +95,7 @@ auto While::Codegen(CompilationUnit &unit) const noexcept
   auto *body_value = body_outcome.GetFirst();
   assert(body_value != nullptr);
   unit.CreateBr(test_BB);
+  unit.EndSSALoop(loop, unit.GetInsertionPoint().block, std::move(exit));
 
   unit.SetInsertionPoint(end_BB);
   unit.InsertBasicBlock(end_BB);
@@ -0,0 +1,200 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ast/visitor/PromotableVariables.h"
+
+#include "ast/All.h"
+
+namespace pink {
+auto PromotableVariables::Compute(const Ast *body) noexcept -> Set {
+  PromotableVariables visitor;
+  visitor.Analyze(body);
+
+  Set promotable;
+  for (auto symbol : visitor.bound) {
+    if (!visitor.escaping.contains(symbol)) {
+      promotable.insert(symbol);
+    }
+  }
+  return promotable;
+}
+
+void PromotableVariables::Analyze(const Ast *ast) const noexcept {
+  assert(ast != nullptr);
+  // #NOTE: Accept takes a non-const visitor, while Visit is const.
+  // the state of the analysis is mutable, so this is safe.
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  ast->Accept(const_cast<PromotableVariables *>(this));
+}
+
+void PromotableVariables::Visit(const AddressOf *address_of) const noexcept {
+  auto within = within_address;
+  within_address = true;
+  Analyze(address_of->GetRight().get());
+  within_address = within;
+}
+
+void PromotableVariables::Visit(
+    const Application *application) const noexcept {
+  Analyze(application->GetCallee().get());
+  for (const auto &argument : *application) {
+    Analyze(argument.get());
+  }
+}
+
+void PromotableVariables::Visit(const Array *array) const noexcept {
+  for (const auto &element : *array) {
+    Analyze(element.get());
+  }
+}
+
+void PromotableVariables::Visit(const Assignment *assignment) const noexcept {
+  // #RULE assignment to a lane of a vector variable
+  // only replaces the value of the variable
+  if (auto [vector, lane] = assignment->GetLane(); vector != nullptr) {
+    auto within = within_address;
+    within_address = !llvm::isa<Variable>(vector);
+    Analyze(vector);
+    within_address = false;
+    Analyze(lane);
+    within_address = within;
+  } else if (!llvm::isa<Variable>(assignment->GetLeft())) {
+    // every other left hand side is used by address
+    auto within = within_address;
+    within_address = true;
+    Analyze(assignment->GetLeft().get());
+    within_address = within;
+  }
+  Analyze(assignment->GetRight().get());
+}
+
+void PromotableVariables::Visit(const Bind *bind) const noexcept {
+  bound.insert(bind->GetSymbol());
+  Analyze(bind->GetAffix().get());
+}
+
+void PromotableVariables::Visit(const Binop *binop) const noexcept {
+  Analyze(binop->GetLeft().get());
+  Analyze(binop->GetRight().get());
+}
+
+void PromotableVariables::Visit(const Block *block) const noexcept {
+  for (const auto &expression : *block) {
+    Analyze(expression.get());
+  }
+}
+
+void PromotableVariables::Visit(
+    [[maybe_unused]] const Boolean *boolean) const noexcept {}
+
+void PromotableVariables::Visit(const Cast *cast) const noexcept {
+  Analyze(cast->GetRight().get());
+}
+
+void PromotableVariables::Visit(
+    const IfThenElse *conditional) const noexcept {
+  Analyze(conditional->GetTest().get());
+  Analyze(conditional->GetFirst().get());
+  Analyze(conditional->GetSecond().get());
+}
+
+void PromotableVariables::Visit(const Dot *dot) const noexcept {
+  Analyze(dot->GetLeft().get());
+  Analyze(dot->GetRight().get());
+}
+
+void PromotableVariables::Visit(
+    [[maybe_unused]] const Float *literal) const noexcept {}
+
+void PromotableVariables::Visit(const For *loop) const noexcept {
+  // the loop variable is bound by the loop, like a Bind
+  bound.insert(loop->GetSymbol());
+  Analyze(loop->GetFirst().get());
+  if (loop->IsRange()) {
+    Analyze(loop->GetLast().get());
+  }
+  Analyze(loop->GetBody().get());
+}
+
+void PromotableVariables::Visit(const Function *function) const noexcept {
+  Analyze(function->GetBody().get());
+}
+
+void PromotableVariables::Visit(
+    [[maybe_unused]] const Integer *integer) const noexcept {}
+
+void PromotableVariables::Visit(const Intrinsic *intrinsic) const noexcept {
+  for (const auto &argument : *intrinsic) {
+    Analyze(argument.get());
+  }
+}
+
+void PromotableVariables::Visit(
+    [[maybe_unused]] const Nil *nil) const noexcept {}
+
+void PromotableVariables::Visit(const Subscript *subscript) const noexcept {
+  Analyze(subscript->GetLeft().get());
+  // the index is always read by value
+  auto within = within_address;
+  within_address = false;
+  Analyze(subscript->GetRight().get());
+  within_address = within;
+}
+
+void PromotableVariables::Visit(const Tuple *tuple) const noexcept {
+  for (const auto &element : *tuple) {
+    Analyze(element.get());
+  }
+}
+
+void PromotableVariables::Visit(const Unop *unop) const noexcept {
+  Analyze(unop->GetRight().get());
+}
+
+void PromotableVariables::Visit(const ValueOf *value_of) const noexcept {
+  Analyze(value_of->GetRight().get());
+}
+
+void PromotableVariables::Visit(const Variable *variable) const noexcept {
+  if (within_address) {
+    escaping.insert(variable->GetSymbol());
+  }
+}
+
+void PromotableVariables::Visit(const Vector *vector) const noexcept {
+  const auto &arguments = vector->GetArguments();
+  if (!vector->IsLoad()) {
+    for (const auto &argument : arguments) {
+      Analyze(argument.get());
+    }
+    return;
+  }
+
+  Analyze(arguments[0].get());
+  // the index is always read by value
+  auto within = within_address;
+  within_address = false;
+  Analyze(arguments[1].get());
+  within_address = within;
+}
+
+void PromotableVariables::Visit(const While *loop) const noexcept {
+  Analyze(loop->GetTest().get());
+  Analyze(loop->GetBody().get());
+}
+} // namespace pink
@@ -0,0 +1,183 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ast/visitor/ReachableFunctions.h"
+
+#include "llvm/ADT/DenseMap.h"
+
+#include "ast/All.h"
+
+namespace pink {
+auto ReachableFunctions::Compute(const Terms                   &terms,
+                                 llvm::ArrayRef<InternedString> roots) noexcept
+    -> Set {
+  ReachableFunctions                                visitor;
+  llvm::DenseMap<InternedString, const Function *> functions;
+
+  visitor.referenced.assign(roots.begin(), roots.end());
+  for (const auto &term : terms) {
+    if (const auto *function = llvm::dyn_cast<Function>(term.get())) {
+      functions[function->GetName()] = function;
+    } else {
+      // #RULE every top level term which is not a function
+      // is always compiled, so it's references are roots.
+      visitor.Analyze(term.get());
+    }
+  }
+
+  Set reachable;
+  while (!visitor.referenced.empty()) {
+    auto symbol = visitor.referenced.back();
+    visitor.referenced.pop_back();
+
+    auto found = functions.find(symbol);
+    if (found == functions.end()) {
+      continue;
+    }
+
+    if (reachable.insert(symbol).second) {
+      visitor.Analyze(found->second->GetBody().get());
+    }
+  }
+  return reachable;
+}
+
+void ReachableFunctions::Analyze(const Ast *ast) const noexcept {
+  assert(ast != nullptr);
+  // #NOTE: Accept takes a non-const visitor, while Visit is const.
+  // the state of the analysis is mutable, so this is safe.
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  ast->Accept(const_cast<ReachableFunctions *>(this));
+}
+
+void ReachableFunctions::Visit(const AddressOf *address_of) const noexcept {
+  Analyze(address_of->GetRight().get());
+}
+
+void ReachableFunctions::Visit(const Application *application) const noexcept {
+  Analyze(application->GetCallee().get());
+  for (const auto &argument : *application) {
+    Analyze(argument.get());
+  }
+}
+
+void ReachableFunctions::Visit(const Array *array) const noexcept {
+  for (const auto &element : *array) {
+    Analyze(element.get());
+  }
+}
+
+void ReachableFunctions::Visit(const Assignment *assignment) const noexcept {
+  Analyze(assignment->GetLeft().get());
+  Analyze(assignment->GetRight().get());
+}
+
+void ReachableFunctions::Visit(const Bind *bind) const noexcept {
+  Analyze(bind->GetAffix().get());
+}
+
+void ReachableFunctions::Visit(const Binop *binop) const noexcept {
+  Analyze(binop->GetLeft().get());
+  Analyze(binop->GetRight().get());
+}
+
+void ReachableFunctions::Visit(const Block *block) const noexcept {
+  for (const auto &expression : *block) {
+    Analyze(expression.get());
+  }
+}
+
+void ReachableFunctions::Visit(
+    [[maybe_unused]] const Boolean *boolean) const noexcept {}
+
+void ReachableFunctions::Visit(const Cast *cast) const noexcept {
+  Analyze(cast->GetRight().get());
+}
+
+void ReachableFunctions::Visit(const IfThenElse *conditional) const noexcept {
+  Analyze(conditional->GetTest().get());
+  Analyze(conditional->GetFirst().get());
+  Analyze(conditional->GetSecond().get());
+}
+
+void ReachableFunctions::Visit(const Dot *dot) const noexcept {
+  Analyze(dot->GetLeft().get());
+  Analyze(dot->GetRight().get());
+}
+
+void ReachableFunctions::Visit(
+    [[maybe_unused]] const Float *literal) const noexcept {}
+
+void ReachableFunctions::Visit(const For *loop) const noexcept {
+  Analyze(loop->GetFirst().get());
+  if (loop->IsRange()) {
+    Analyze(loop->GetLast().get());
+  }
+  Analyze(loop->GetBody().get());
+}
+
+void ReachableFunctions::Visit(const Function *function) const noexcept {
+  Analyze(function->GetBody().get());
+}
+
+void ReachableFunctions::Visit(
+    [[maybe_unused]] const Integer *integer) const noexcept {}
+
+void ReachableFunctions::Visit(const Intrinsic *intrinsic) const noexcept {
+  for (const auto &argument : *intrinsic) {
+    Analyze(argument.get());
+  }
+}
+
+void ReachableFunctions::Visit(
+    [[maybe_unused]] const Nil *nil) const noexcept {}
+
+void ReachableFunctions::Visit(const Subscript *subscript) const noexcept {
+  Analyze(subscript->GetLeft().get());
+  Analyze(subscript->GetRight().get());
+}
+
+void ReachableFunctions::Visit(const Tuple *tuple) const noexcept {
+  for (const auto &element : *tuple) {
+    Analyze(element.get());
+  }
+}
+
+void ReachableFunctions::Visit(const Unop *unop) const noexcept {
+  Analyze(unop->GetRight().get());
+}
+
+void ReachableFunctions::Visit(const ValueOf *value_of) const noexcept {
+  Analyze(value_of->GetRight().get());
+}
+
+void ReachableFunctions::Visit(const Variable *variable) const noexcept {
+  referenced.push_back(variable->GetSymbol());
+}
+
+void ReachableFunctions::Visit(const Vector *vector) const noexcept {
+  for (const auto &argument : *vector) {
+    Analyze(argument.get());
+  }
+}
+
+void ReachableFunctions::Visit(const While *loop) const noexcept {
+  Analyze(loop->GetTest().get());
+  Analyze(loop->GetBody().get());
+}
+} // namespace pink
@@ -18,6 +18,7 @@
 #include <getopt.h>
 
 #include <algorithm>
+#include <optional>
 #include <vector>
 
 #include "PinkConfig.h"
@@ -60,6 +61,7 @@ auto CLIOptions::PrintHelp(std::ostream &out) -> std::ostream & {
       << "General program options: \n"
       << "-h, --help: print this help message and exit.\n"
       << "-v, --version: print version information and exit.\n"
+      << "-V, --verbose: print extra information while compiling.\n"
       << "-i <arg>, --infile <arg>, --input <arg>: specifies the input source "
          "filename.\n"
       << "-o <arg>, --outfile <arg>, --output <arg>: specifies the output "
@@ -68,9 +70,65 @@ auto CLIOptions::PrintHelp(std::ostream &out) -> std::ostream & {
       << "\n\t valid arguments are:"
       << "\n\t\t 0 (none),\n\t\t 1 (limited),\n\t\t 2 (regular),"
       << "\n\t\t 3 (high, may affect compile times),\n\t\t s (small code size),"
-      << " \n\t\t z (very small code size at performance cost)\n"
-      << "-c --emit-object: emit llvm IR instead of an executable\n"
+      << " \n\t\t z (very small code size at performance cost),"
+      << "\n\t\t g (fast compilation, runs mem2reg, early-cse, instcombine "
+         "and simplifycfg, and skips verification of each function, "
+         "cannot be combined with --profile-generate)\n"
+      << "--verify, --no-verify: verify (the default, except for -Og) or "
+         "skip verifying each function as it is generated\n"
+      << "-B <arg>, --bounds-checks <arg>: specifies how subscripts are "
+         "bounds checked."
+      << "\n\t valid arguments are:"
+      << "\n\t\t off (no checks),\n\t\t on (default),"
+      << "\n\t\t hoisted (checks within loops are hoisted out of the loop "
+         "where possible, requires -O1 or higher)\n"
+      << "-m <arg>, --march <arg>, --mcpu <arg>: specifies the target cpu."
+      << "\n\t valid arguments are:"
+      << "\n\t\t native (the host cpu, default),"
+      << "\n\t\t x86-64, x86-64-v2, x86-64-v3, x86-64-v4 (microarchitecture "
+         "levels),"
+      << "\n\t\t or any cpu name known to llvm, such as znver3\n"
+      << "-A <arg>, --mattr <arg>: specifies additional target features, "
+         "such as +avx2,-fma\n"
+      << "-R <arg>, --relocation-model <arg>: specifies the relocation model."
+      << "\n\t valid arguments are:"
+      << "\n\t\t static (default, we link a non-PIE executable),"
+      << "\n\t\t pic (position independent code)\n"
+      << "-f --function-sections: place each function in its own section, "
+         "such that the linker removes unused functions\n"
+      << "-G[<arg>], --profile-generate[=<arg>]: instrument the program such "
+         "that it writes a raw profile into <arg> when it exits, by default "
+         "<output>.profraw. (merge raw profiles with llvm-profdata merge, "
+         "ignored with --run)\n"
+      << "-U <arg>, --profile-use <arg>: optimize using the merged profile "
+         "<arg>\n"
+      << "-P <arg>, --passes <arg>: run the textual pass pipeline <arg> "
+         "instead of the default pipeline for the optimization level, "
+         "such as \"default<O2>\" or \"function(sroa,instcombine)\". "
+         "(cannot be combined with --profile-generate)\n"
+      << "-T --print-pass-timings: print the time taken by each pass\n"
+      << "-e <arg>, --export <arg>: compile the function <arg> (or a comma "
+         "separated list of functions) even when it is not reachable from "
+         "main\n"
+      << "-a --check-all: typecheck and compile every function, not only "
+         "those reachable from main or exported. (functions are only "
+         "skipped when compiling the whole program)\n"
+      << "-W --whole-program: treat the output as the whole program, such "
+         "that only main and exported functions are external, and every "
+         "other function has internal linkage and the fast calling "
+         "convention. (the default when linking an executable or with "
+         "--run)\n"
+      << "-F --fast-math: allow floating point arithmetic to be reassociated "
+         "and contracted, assuming no NaNs or infinities, such that float "
+         "reductions can be vectorized\n"
+      << "-b --emit-bc: emit llvm bitcode with a ThinLTO summary instead of "
+         "an executable\n"
+      << "-c --emit-object: emit an object file instead of an executable\n"
       << "-s --emit-asm: emit assembly instead of an executable\n"
+      << "-r --run: compile and run the program in memory, emitting no "
+         "executable\n"
+      << "-t --lto, --thin-lto: link bitcode instead of an object file, such "
+         "that lld performs ThinLTO in parallel\n"
       << "\n";
   return out;
 }
@@ -82,29 +140,59 @@ auto CLIOptions::PrintHelp(std::ostream &out) -> std::ostream & {
 auto ParseCLIOptions(std::ostream &out, int argc, char **argv)
     -> Outcome<CLIOptions> {
   int         numopt        = 0; // count of how many options we parsed
-  const char *short_options = "hvi:o:O:lcs";
-
-  fs::path                input_file;
-  fs::path                output_file;
-  CLIFlags                flags;
-  llvm::OptimizationLevel optimization_level = llvm::OptimizationLevel::O0;
+  const char *short_options = "hvVi:o:O:B:m:A:R:G::U:P:e:lbcsrtfTyYaWF";
+
+  fs::path                 input_file;
+  fs::path                 output_file;
+  std::string              target_cpu{CLIOptions::native_cpu};
+  std::string              target_features;
+  fs::path                 profile_generate_file;
+  fs::path                 profile_use_file;
+  std::string              passes;
+  std::vector<std::string> exports;
+  CLIFlags                 flags;
+  llvm::OptimizationLevel  optimization_level = llvm::OptimizationLevel::O0;
+  std::optional<bool>      verify;
 
   // note: we have to use c style programming here to interop with getopt_long
   // NOLINTBEGIN
   static struct option long_options[] = {
       {"help", no_argument, nullptr, 'h'},
       {"version", no_argument, nullptr, 'v'},
+      {"verbose", no_argument, nullptr, 'V'},
       {"infile", required_argument, nullptr, 'i'},
       {"input", required_argument, nullptr, 'i'},
       {"outfile", required_argument, nullptr, 'o'},
       {"output", required_argument, nullptr, 'o'},
       {"optimize", required_argument, nullptr, 'O'},
+      {"bounds-checks", required_argument, nullptr, 'B'},
+      {"march", required_argument, nullptr, 'm'},
+      {"mcpu", required_argument, nullptr, 'm'},
+      {"mattr", required_argument, nullptr, 'A'},
+      {"relocation-model", required_argument, nullptr, 'R'},
+      {"function-sections", no_argument, nullptr, 'f'},
+      {"profile-generate", optional_argument, nullptr, 'G'},
+      {"profile-use", required_argument, nullptr, 'U'},
+      {"passes", required_argument, nullptr, 'P'},
+      {"print-pass-timings", no_argument, nullptr, 'T'},
+      {"verify", no_argument, nullptr, 'y'},
+      {"no-verify", no_argument, nullptr, 'Y'},
+      {"time-passes", no_argument, nullptr, 'T'},
+      {"export", required_argument, nullptr, 'e'},
+      {"check-all", no_argument, nullptr, 'a'},
+      {"whole-program", no_argument, nullptr, 'W'},
+      {"fast-math", no_argument, nullptr, 'F'},
       {"emit-llvm", no_argument, nullptr, 'l'},
       {"emit-ll", no_argument, nullptr, 'l'},
+      {"emit-bc", no_argument, nullptr, 'b'},
+      {"emit-bitcode", no_argument, nullptr, 'b'},
       {"emit-object", no_argument, nullptr, 'c'},
       {"emit-obj", no_argument, nullptr, 'c'},
       {"emit-assembly", no_argument, nullptr, 's'},
       {"emit-asm", no_argument, nullptr, 's'},
+      {"run", no_argument, nullptr, 'r'},
+      {"thin-lto", no_argument, nullptr, 't'},
+      {"lto", no_argument, nullptr, 't'},
       {nullptr, 0, nullptr, 0}};
 
   int option = 0;
@@ -141,6 +229,11 @@ auto ParseCLIOptions(std::ostream &out, int argc, char **argv)
       break;
     }
 
+    case 'V': {
+      flags.DoVerbose(true);
+      break;
+    }
+
     case 'i': {
       input_file = optarg;
       break;
@@ -158,6 +251,13 @@ auto ParseCLIOptions(std::ostream &out, int argc, char **argv)
       break;
     }
 
+    case 'b': {
+      flags.DoEmitBitcode(true);
+      flags.DoEmitObject(false);
+      flags.DoLink(false);
+      break;
+    }
+
     case 'c': {
       flags.DoEmitObject(true);
       flags.DoLink(false);
@@ -171,7 +271,137 @@ auto ParseCLIOptions(std::ostream &out, int argc, char **argv)
       break;
     }
 
+    case 'r': {
+      flags.DoRun(true);
+      flags.DoEmitObject(false);
+      flags.DoLink(false);
+      break;
+    }
+
+    case 't': {
+      flags.DoLinkTimeOptimization(true);
+      break;
+    }
+
+    case 'm': {
+      target_cpu = optarg;
+      break;
+    }
+
+    case 'A': {
+      if (!target_features.empty()) {
+        target_features += ",";
+      }
+      target_features += optarg;
+      break;
+    }
+
+    case 'G': {
+      flags.DoProfileGenerate(true);
+      if (optarg != nullptr) {
+        profile_generate_file = optarg;
+      }
+      break;
+    }
+
+    case 'U': {
+      profile_use_file = optarg;
+      break;
+    }
+
+    case 'y': {
+      verify = true;
+      break;
+    }
+
+    case 'Y': {
+      verify = false;
+      break;
+    }
+
+    case 'P': {
+      passes = optarg;
+      break;
+    }
+
+    case 'T': {
+      flags.DoPrintPassTimings(true);
+      break;
+    }
+
+    case 'e': {
+      std::string_view symbols{optarg};
+      while (!symbols.empty()) {
+        auto comma  = symbols.find(',');
+        auto symbol = symbols.substr(0, comma);
+        if (!symbol.empty()) {
+          exports.emplace_back(symbol);
+        }
+        if (comma == std::string_view::npos) {
+          break;
+        }
+        symbols.remove_prefix(comma + 1);
+      }
+      break;
+    }
+
+    case 'a': {
+      flags.DoCheckAll(true);
+      break;
+    }
+
+    case 'W': {
+      flags.DoWholeProgram(true);
+      break;
+    }
+
+    case 'F': {
+      flags.DoFastMath(true);
+      break;
+    }
+
+    case 'f': {
+      flags.DoFunctionSections(true);
+      break;
+    }
+
+    case 'R': {
+      std::string_view model{optarg};
+      if (model == "static") {
+        flags.DoPositionIndependentCode(false);
+      } else if (model == "pic") {
+        flags.DoPositionIndependentCode(true);
+      } else {
+        std::string errmsg{"saw ["};
+        errmsg += model;
+        errmsg += "]";
+        return Error{Error::Code::BadRelocationModel, {}, errmsg};
+      }
+      break;
+    }
+
+    case 'B': {
+      std::string_view mode{optarg};
+      if (mode == "off") {
+        flags.DoBoundsChecks(false);
+        flags.DoHoistBoundsChecks(false);
+      } else if (mode == "on") {
+        flags.DoBoundsChecks(true);
+        flags.DoHoistBoundsChecks(false);
+      } else if (mode == "hoisted") {
+        flags.DoBoundsChecks(true);
+        flags.DoHoistBoundsChecks(true);
+      } else {
+        std::string errmsg{"saw ["};
+        errmsg += mode;
+        errmsg += "]";
+        return Error{Error::Code::BadBoundsChecksMode, {}, errmsg};
+      }
+      break;
+    }
+
     case 'O': {
+      flags.DoOptimizeDebug(false);
       switch (optarg[0]) {
       case '0': {
         optimization_level = llvm::OptimizationLevel::O0;
@@ -203,6 +433,12 @@ auto ParseCLIOptions(std::ostream &out, int argc, char **argv)
         break;
       }
 
+      case 'g': {
+        optimization_level = llvm::OptimizationLevel::O0;
+        flags.DoOptimizeDebug(true);
+        break;
+      }
+
       default: {
         std::string errmsg{"saw ["};
         errmsg += (char)option;
@@ -227,6 +463,29 @@ auto ParseCLIOptions(std::ostream &out, int argc, char **argv)
     }
   }
 
+  // #RULE only the default pipelines instrument the program,
+  // so neither a pipeline given by --passes nor the -Og
+  // pipeline can generate a profile.
+  if (flags.DoProfileGenerate() && !passes.empty()) {
+    return Error{Error::Code::IncompatibleOptions,
+                 {},
+                 "saw [--profile-generate] with [--passes]"};
+  }
+  if (flags.DoProfileGenerate() && flags.DoOptimizeDebug()) {
+    return Error{Error::Code::IncompatibleOptions,
+                 {},
+                 "saw [--profile-generate] with [-Og]"};
+  }
+
+  // -Og skips verification unless it was explicitly asked for
+  flags.DoVerify(verify.value_or(!flags.DoOptimizeDebug()));
+
+  // an executable, or a program run in memory, is always the
+  // whole program, as nothing else can call into it.
+  if (flags.DoLink() || flags.DoRun()) {
+    flags.DoWholeProgram(true);
+  }
+
   if (input_file.empty()) {
     int infile_option_index = optind + 1 + numopt;
     if (optind >= argc || infile_option_index >= argc) {
@@ -247,7 +506,16 @@ auto ParseCLIOptions(std::ostream &out, int argc, char **argv)
     output_file.replace_extension();
   }
 
-  return CLIOptions{input_file, output_file, flags, optimization_level};
+  return CLIOptions{input_file,
+                    output_file,
+                    flags,
+                    optimization_level,
+                    target_cpu,
+                    target_features,
+                    profile_generate_file,
+                    profile_use_file,
+                    passes,
+                    exports};
 }
 // NOLINTEND
 } // namespace pink
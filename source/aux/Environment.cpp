@@ -15,6 +15,9 @@
 // You should have received a copy of the GNU General Public License
 // along with pink.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <algorithm>
+#include <bit>
+#include <chrono>
 #include <fstream>
 #include <random>
 #include <sstream>
@@ -23,6 +26,7 @@
 
 #include "ast/Function.h"
 #include "ast/action/Codegen.h"
+#include "ast/visitor/ReachableFunctions.h"
 
 #include "ops/BinopPrimitives.h"
 #include "ops/UnopPrimitives.h"
@@ -32,16 +36,36 @@
 #include "support/LLVMTypeToString.h"
 
 #include "llvm/Support/Host.h"
+#include "llvm/Support/raw_os_ostream.h"
 #include "llvm/Support/TargetSelect.h"
 
+#include "llvm/MC/MCSubtargetInfo.h"
 #include "llvm/MC/TargetRegistry.h"
 
 #include "llvm/IR/LegacyPassManager.h"
+#include "llvm/IR/MDBuilder.h"
+#include "llvm/IR/PassTimingInfo.h"
 
 #include "llvm/Analysis/AliasAnalysis.h"
+#include "llvm/Analysis/ModuleSummaryAnalysis.h"
+#include "llvm/Analysis/ProfileSummaryInfo.h"
+
+#include "llvm/Bitcode/BitcodeWriter.h"
 
 #include "llvm/Passes/PassBuilder.h"
 
+#include "llvm/ProfileData/InstrProf.h"
+
+#include "llvm/Support/PGOOptions.h"
+
+#include "llvm/Transforms/Utils/ModuleUtils.h"
+
+#include "llvm/Transforms/InstCombine/InstCombine.h"
+#include "llvm/Transforms/Scalar/EarlyCSE.h"
+#include "llvm/Transforms/Scalar/InductiveRangeCheckElimination.h"
+#include "llvm/Transforms/Scalar/SimplifyCFG.h"
+#include "llvm/Transforms/Utils/Mem2Reg.h"
+
 namespace pink {
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
  *
@@ -50,22 +74,6 @@ namespace pink {
  *
  *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-auto CompilationUnit::ToConstantInit(std::string_view text)
-    -> std::vector<llvm::Constant *> {
-  std::vector<llvm::Constant *> buffer{text.size()};
-  auto                          cursor = buffer.begin();
-  auto                          end    = buffer.end();
-  for (auto character : text) {
-    *cursor = ConstantCharacter(static_cast<uint8_t>(character));
-    cursor++;
-
-    if (cursor == end) {
-      break;
-    }
-  }
-  return buffer;
-}
-
 /*
  * #TODO: maybe we allow the caller to seed the rng?
  * or maybe there is an rng per Environment?
@@ -94,6 +102,12 @@ auto CompilationUnit::EmitFiles(std::ostream &err) const -> int {
     }
   }
 
+  if (cli_options.DoEmitBitcode()) {
+    if (EmitBitcodeFile(err) == EXIT_FAILURE) {
+      return EXIT_FAILURE;
+    }
+  }
+
   if (cli_options.DoEmitObject()) {
     if (EmitObjectFile(err) == EXIT_FAILURE) {
       return EXIT_FAILURE;
@@ -122,6 +136,42 @@ auto CompilationUnit::EmitLLVMIRFile(std::ostream &err) const -> int {
   return EXIT_SUCCESS;
 }
 
+auto CompilationUnit::EmitBitcodeFile(std::ostream &err) const -> int {
+  auto                 filename = cli_options.GetBitcodeFile();
+  std::error_code      outfile_error{};
+  llvm::raw_fd_ostream outfile{filename.c_str(), outfile_error};
+  if (outfile_error) {
+    err << "Couldn't open output file [" << filename << "] " << outfile_error
+        << "\n";
+    return EXIT_FAILURE;
+  }
+
+  return EmitBitcode(outfile, err);
+}
+
+auto CompilationUnit::EmitBitcodeBuffer(llvm::SmallVectorImpl<char> &buffer,
+                                        std::ostream &err) const -> int {
+  llvm::raw_svector_ostream outbuffer{buffer};
+  return EmitBitcode(outbuffer, err);
+}
+
+auto CompilationUnit::EmitBitcode(llvm::raw_ostream           &outstream,
+                                  [[maybe_unused]] std::ostream &err) const
+    -> int {
+  // #NOTE: we have no profile data or block frequency info
+  // to offer the summary, so the summary is built from the
+  // static structure of the module alone.
+  llvm::ProfileSummaryInfo profile_summary{*module};
+  auto                     summary_index =
+      llvm::buildModuleSummaryIndex(*module, nullptr, &profile_summary);
+
+  llvm::WriteBitcodeToFile(*module,
+                           outstream,
+                           /* ShouldPreserveUseListOrder */ false,
+                           &summary_index);
+  return EXIT_SUCCESS;
+}
+
 auto CompilationUnit::EmitObjectFile(std::ostream &err) const -> int {
   auto                 filename = cli_options.GetObjectFile();
   std::error_code      outfile_error{};
@@ -132,11 +182,22 @@ auto CompilationUnit::EmitObjectFile(std::ostream &err) const -> int {
     return EXIT_FAILURE;
   }
 
+  return EmitObject(outfile, err);
+}
+
+auto CompilationUnit::EmitObjectBuffer(llvm::SmallVectorImpl<char> &buffer,
+                                       std::ostream &err) const -> int {
+  llvm::raw_svector_ostream outbuffer{buffer};
+  return EmitObject(outbuffer, err);
+}
+
+auto CompilationUnit::EmitObject(llvm::raw_pwrite_stream &outstream,
+                                 std::ostream            &err) const -> int {
   llvm::legacy::PassManager AssemblyPrinter;
 
   bool failed{target_machine->addPassesToEmitFile(
       AssemblyPrinter,
-      outfile,
+      outstream,
       nullptr,
       llvm::CodeGenFileType::CGFT_ObjectFile)};
 
@@ -189,6 +250,13 @@ auto CompilationUnit::Compile(std::ostream &out, std::ostream &err) -> int {
     return EXIT_FAILURE;
   }
 
+  // #NOTE: only the whole program has main as it's entry point,
+  // any function of an object or of bitcode may be called by the
+  // program it is linked into.
+  if (DoWholeProgram() && !DoCheckAll()) {
+    RemoveUnreachableFunctions(parse_result.GetFirst(), out);
+  }
+
   auto typecheck_errors = TypecheckTerms(parse_result.GetFirst());
   if (typecheck_errors) {
     for (auto &error : typecheck_errors.value()) {
@@ -207,35 +275,75 @@ auto CompilationUnit::Compile(std::ostream &out, std::ostream &err) -> int {
 
 auto CompilationUnit::ParseInputFile([[maybe_unused]] std::ostream &err)
     -> Outcome<Terms, Error> {
-  Terms terms;
-  {
-    std::fstream infile;
-    infile.open(GetInputFile());
-    if (!infile.is_open()) {
-      std::string errmsg{"Could not open input file ["};
-      errmsg += GetInputFile();
-      errmsg += "]\n";
-      FatalError(errmsg);
-    }
+  std::fstream infile;
+  infile.open(GetInputFile());
+  if (!infile.is_open()) {
+    std::string errmsg{"Could not open input file ["};
+    errmsg += GetInputFile();
+    errmsg += "]\n";
+    FatalError(errmsg);
+  }
 
-    SetIStream(&infile);
-    while (!EndOfInput()) {
-      auto term_result = Parse();
+  SetIStream(&infile);
+  return ParseTerms();
+}
 
-      if (!term_result) {
-        auto &error = term_result.GetSecond();
-        if ((error.code == Error::Code::EndOfFile) && (!terms.empty())) {
-          break;
-        }
-        return std::move(error);
-      }
+auto CompilationUnit::ParseTerms() -> Outcome<Terms, Error> {
+  Terms terms;
+  while (!EndOfInput()) {
+    auto term_result = Parse();
 
-      terms.emplace_back(std::move(term_result.GetFirst()));
+    if (!term_result) {
+      auto &error = term_result.GetSecond();
+      if ((error.code == Error::Code::EndOfFile) && (!terms.empty())) {
+        break;
+      }
+      return std::move(error);
     }
+
+    terms.emplace_back(std::move(term_result.GetFirst()));
   }
   return terms;
 }
 
+auto CompilationUnit::IsExternal(std::string_view name) const -> bool {
+  if (!DoWholeProgram() || (name == "main")) {
+    return true;
+  }
+  const auto &exports = GetExports();
+  return std::find(exports.begin(), exports.end(), name) != exports.end();
+}
+
+// #RULE functions of the whole program which are not reachable from
+// main, or from an exported symbol, are neither typechecked nor generated.
+auto CompilationUnit::RemoveUnreachableFunctions(Terms &terms, std::ostream &out)
+    -> void {
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<InternedString> roots;
+  roots.push_back(InternVariable("main"));
+  for (const auto &symbol : GetExports()) {
+    roots.push_back(InternVariable(symbol));
+  }
+  auto reachable = ReachableFunctions::Compute(terms, roots);
+
+  auto total     = terms.size();
+  auto unreached = [&reachable](const Term &term) {
+    const auto *function = llvm::dyn_cast<Function>(term.get());
+    return (function != nullptr) && (reachable.count(function->GetName()) == 0);
+  };
+  terms.erase(std::remove_if(terms.begin(), terms.end(), unreached),
+              terms.end());
+
+  if (DoVerbose()) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    out << "Skipped [" << total - terms.size() << "] of [" << total
+        << "] top level terms unreachable from main, in [" << elapsed.count()
+        << "us]\n";
+  }
+}
+
 auto CompilationUnit::TypecheckTerms(Terms &terms) -> std::optional<Errors> {
   Errors errors;
   for (const auto &term : terms) {
@@ -260,21 +368,77 @@ auto CompilationUnit::CodegenTerms(Terms &terms) -> std::optional<Error> {
       return std::move(outcome.GetSecond());
     }
   }
+
+  // #NOTE: a program run within the JIT uses the memory
+  // routines of the host, and an object which is not
+  // linked here is linked against some libc elsewhere.
+  if (DoLink() && !DoRun()) {
+    EmitMemoryRuntime();
+  }
   return {};
 }
 
 // we may want to print errors at some point. (it happened for Compile and Link)
-auto CompilationUnit::DefaultAnalysis([[maybe_unused]] std::ostream &err)
-    -> int {
+auto CompilationUnit::DefaultAnalysis(std::ostream &err) -> int {
+  // the target cpu is recorded on each function, such that
+  // code generated by lld during LTO targets the same cpu.
+  for (auto &function : *module) {
+    if (function.isDeclaration()) {
+      continue;
+    }
+    function.addFnAttr("target-cpu", GetTargetCPU());
+    function.addFnAttr("target-features", GetTargetFeatures());
+  }
+
+  // the backend runs within the legacy pass manager, which
+  // reports its pass timings when llvm shuts down.
+  llvm::TimePassesIsEnabled = DoPrintPassTimings();
+
+  std::optional<llvm::PGOOptions> pgo_options;
+  if (DoProfileGenerate()) {
+    pgo_options = llvm::PGOOptions{GetProfileGenerateFile().string(),
+                                   "",
+                                   "",
+                                   llvm::PGOOptions::IRInstr};
+  } else if (DoProfileUse()) {
+    pgo_options = llvm::PGOOptions{GetProfileUseFile().string(),
+                                   "",
+                                   "",
+                                   llvm::PGOOptions::IRUse};
+  }
+
   // quote: buildPerModuleDefaultPipeline "... Level cannot be 'O0' here ..."
-  if (GetOptimizationLevel() != llvm::OptimizationLevel::O0) {
+  // though instrumentation is still added by the O0 pipeline,
+  // and a pipeline given by --passes is run at any level.
+  if (GetOptimizationLevel() != llvm::OptimizationLevel::O0 ||
+      DoOptimizeDebug() || DoProfileGenerate() || !GetPasses().empty()) {
     llvm::LoopAnalysisManager     LAM;
     llvm::FunctionAnalysisManager FAM;
     llvm::CGSCCAnalysisManager    CGAM;
     llvm::ModuleAnalysisManager   MAM;
 
+    llvm::PassInstrumentationCallbacks PIC;
+    llvm::TimePassesHandler            pass_timings{DoPrintPassTimings()};
+    pass_timings.registerCallbacks(PIC);
+
     // https://llvm.org/doxygen/classllvm_1_1PassBuilder.html
-    llvm::PassBuilder passBuilder;
+    // the target machine provides the cost model for the target cpu
+    // to the vectorizers, unrolling, and inlining.
+    llvm::PassBuilder passBuilder{target_machine,
+                                  llvm::PipelineTuningOptions{},
+                                  pgo_options,
+                                  &PIC};
+
+    // #NOTE: loop invariant bounds checks are already hoisted by
+    // loop unswitching within the default pipeline, IRCE additionally
+    // hoists bounds checks on induction variables into the preheader.
+    if (DoHoistBoundsChecks()) {
+      passBuilder.registerScalarOptimizerLateEPCallback(
+          [](llvm::FunctionPassManager &FPM,
+             [[maybe_unused]] llvm::OptimizationLevel level) {
+            FPM.addPass(llvm::IRCEPass());
+          });
+    }
 
     // #TODO: what are the default analysis that this constructs?
     FAM.registerPass([&] { return passBuilder.buildDefaultAAPipeline(); });
@@ -288,11 +452,52 @@ auto CompilationUnit::DefaultAnalysis([[maybe_unused]] std::ostream &err)
     // can perform optimizations together, lazily
     passBuilder.crossRegisterProxies(LAM, FAM, CGAM, MAM);
 
-    llvm::ModulePassManager MPM =
-        passBuilder.buildPerModuleDefaultPipeline(GetOptimizationLevel());
+    // when the output is destined for ThinLTO we leave the
+    // optimizations which benefit from cross module information
+    // for lld to perform at link time.
+    auto DefaultPipeline = [&]() {
+      // -Og, a small fixed pipeline which removes the allocas,
+      // loads and stores of each Bind, and little else.
+      if (DoOptimizeDebug()) {
+        llvm::FunctionPassManager FPM;
+        FPM.addPass(llvm::PromotePass());
+        FPM.addPass(llvm::EarlyCSEPass());
+        FPM.addPass(llvm::InstCombinePass());
+        FPM.addPass(llvm::SimplifyCFGPass());
+
+        llvm::ModulePassManager MPM;
+        MPM.addPass(llvm::createModuleToFunctionPassAdaptor(std::move(FPM)));
+        return MPM;
+      }
+      if (GetOptimizationLevel() == llvm::OptimizationLevel::O0) {
+        return passBuilder.buildO0DefaultPipeline(
+            GetOptimizationLevel(),
+            DoLinkTimeOptimization() || DoEmitBitcode());
+      }
+      if (DoLinkTimeOptimization() || DoEmitBitcode()) {
+        return passBuilder.buildThinLTOPreLinkDefaultPipeline(
+            GetOptimizationLevel());
+      }
+      return passBuilder.buildPerModuleDefaultPipeline(GetOptimizationLevel());
+    };
+
+    llvm::ModulePassManager MPM;
+    if (GetPasses().empty()) {
+      MPM = DefaultPipeline();
+    } else if (auto error = passBuilder.parsePassPipeline(MPM, GetPasses())) {
+      err << "Couldn't parse the pass pipeline [" << GetPasses() << "] "
+          << llvm::toString(std::move(error)) << "\n";
+      return EXIT_FAILURE;
+    }
 
     // Run the optimizer against the IR
     MPM.run(*module, MAM);
+
+    if (DoPrintPassTimings()) {
+      llvm::raw_os_ostream timings{err};
+      pass_timings.setOutStream(timings);
+      pass_timings.print();
+    }
   }
   return EXIT_SUCCESS;
 }
@@ -341,16 +546,45 @@ auto CompilationUnit::CreateNativeCompilationUnit(CLIOptions    cli_options,
     FatalError(error.data());
   }
 
+  std::string cpu      = cli_options.GetTargetCPU();
+  std::string features = cli_options.GetTargetFeatures();
+  if (cpu == CLIOptions::native_cpu) {
+    cpu = llvm::sys::getHostCPUName().str();
+    // features given on the command line come last, so they
+    // override the detected host features.
+    features = features.empty() ? NativeCPUFeatures()
+                                : NativeCPUFeatures() + "," + features;
+  }
+
+  llvm::TargetOptions target_options;
+  target_options.FunctionSections = cli_options.DoFunctionSections();
+
+  // #NOTE: we link a static executable with --entry main,
+  // so position independent code only costs us GOT loads.
+  auto relocation_model = cli_options.DoPositionIndependentCode()
+                            ? llvm::Reloc::Model::PIC_
+                            : llvm::Reloc::Model::Static;
+
   auto *target_machine =
       target->createTargetMachine(target_triple,
-                                  llvm::sys::getHostCPUName().str(),
-                                  NativeCPUFeatures(),
-                                  llvm::TargetOptions{},
-                                  llvm::Reloc::Model::PIC_,
-                                  llvm::CodeModel::Model::Small);
+                                  cpu,
+                                  features,
+                                  target_options,
+                                  relocation_model,
+                                  llvm::CodeModel::Model::Small,
+                                  cli_options.GetCodeGenOptLevel());
+  if (!target_machine->getMCSubtargetInfo()->isCPUStringValid(cpu)) {
+    FatalError("Unknown target cpu [" + cpu + "]");
+  }
   auto data_layout = target_machine->createDataLayout();
 
   auto instruction_builder = std::make_unique<llvm::IRBuilder<>>(*context);
+  // #NOTE: every floating point instruction is created with these
+  // flags, allowing reassociation is what lets the LoopVectorizer
+  // vectorize a float reduction, at the cost of strict IEEE semantics.
+  if (cli_options.DoFastMath()) {
+    instruction_builder->setFastMathFlags(llvm::FastMathFlags::getFast());
+  }
   auto module =
       std::make_unique<llvm::Module>(cli_options.GetInputFile().stem().c_str(),
                                      *context);
@@ -378,6 +612,43 @@ auto CompilationUnit::CreateTestCompilationUnit() -> CompilationUnit {
   return env;
 }
 
+auto CompilationUnit::GetVectorType(Type::Annotations annotations,
+                                    std::size_t       length,
+                                    Type::Pointer     element_type)
+    -> VectorType::Pointer {
+  const auto *vector_type =
+      type_interner.GetVectorType(annotations, length, element_type);
+  // #NOTE: the set is updated first, as registering the
+  // comparisons asks for the Boolean vector of the same length,
+  // which may be this vector type.
+  if (vector_operators.insert(vector_type).second) {
+    InitializeVectorBinopPrimitives(*this, vector_type);
+    InitializeVectorUnopPrimitives(*this, vector_type);
+  }
+  return vector_type;
+}
+
+auto CompilationUnit::GetLaneType(VectorType::Pointer vector_type)
+    -> Type::Pointer {
+  Type::Annotations annotations;
+  annotations.IsInMemory(false);
+  const auto *element_type = vector_type->GetElementType();
+  if (llvm::isa<BooleanType>(element_type)) {
+    return GetBoolType(annotations);
+  }
+  if (const auto *sized_type = llvm::dyn_cast<SizedIntegerType>(element_type);
+      sized_type != nullptr) {
+    return GetSizedIntType(annotations,
+                           sized_type->GetBitWidth(),
+                           sized_type->IsSigned());
+  }
+  if (const auto *float_type = llvm::dyn_cast<FloatType>(element_type);
+      float_type != nullptr) {
+    return GetFloatType(annotations, float_type->GetBitWidth());
+  }
+  return GetIntType(annotations);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
  *
  *
@@ -385,17 +656,188 @@ auto CompilationUnit::CreateTestCompilationUnit() -> CompilationUnit {
  *
  *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/***************************** SSA Variables *****************************/
+void CompilationUnit::AssignSSAVariable(InternedString symbol,
+                                        llvm::Value   *value) {
+  auto bound = scopes.Lookup(symbol);
+  assert(bound.has_value());
+  assert(bound->IsSSA());
+  bound->Value(value);
+}
+
+auto CompilationUnit::SnapshotSSAVariables() -> SSAValues {
+  SSAValues values;
+  values.reserve(ssa_variables.size());
+  for (auto *symbol : ssa_variables) {
+    auto bound = scopes.Lookup(symbol);
+    assert(bound.has_value());
+    values.emplace_back(bound->Value());
+  }
+  return values;
+}
+
+void CompilationUnit::RestoreSSAVariables(const SSAValues &values) {
+  assert(values.size() <= ssa_variables.size());
+  ssa_variables.resize(values.size());
+  for (std::size_t index = 0; index < values.size(); ++index) {
+    AssignSSAVariable(ssa_variables[index], values[index]);
+  }
+}
+
+void CompilationUnit::MergeSSAVariables(std::size_t       count,
+                                        const SSAValues  &first,
+                                        llvm::BasicBlock *first_block,
+                                        const SSAValues  &second,
+                                        llvm::BasicBlock *second_block) {
+  assert(count <= first.size());
+  assert(count <= second.size());
+  ssa_variables.resize(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    // #NOTE: a variable neither alternative assigns needs no phi
+    if (first[index] == second[index]) {
+      AssignSSAVariable(ssa_variables[index], first[index]);
+      continue;
+    }
+    auto *phi =
+        CreatePHI(first[index]->getType(), 2, ssa_variables[index]);
+    phi->addIncoming(first[index], first_block);
+    phi->addIncoming(second[index], second_block);
+    AssignSSAVariable(ssa_variables[index], phi);
+  }
+}
+
+auto CompilationUnit::BeginSSALoop(llvm::BasicBlock *preheader) -> SSALoop {
+  SSALoop loop{preheader, SnapshotSSAVariables(), {}};
+  loop.phis.reserve(loop.incoming.size());
+  for (std::size_t index = 0; index < loop.incoming.size(); ++index) {
+    auto *value = loop.incoming[index];
+    auto *phi   = CreatePHI(value->getType(), 2, ssa_variables[index]);
+    phi->addIncoming(value, preheader);
+    loop.phis.emplace_back(phi);
+    AssignSSAVariable(ssa_variables[index], phi);
+  }
+  return loop;
+}
+
+void CompilationUnit::EndSSALoop(SSALoop          &loop,
+                                 llvm::BasicBlock *latch,
+                                 SSAValues         exit) {
+  auto latch_values = SnapshotSSAVariables();
+  for (std::size_t index = 0; index < loop.phis.size(); ++index) {
+    loop.phis[index]->addIncoming(latch_values[index], latch);
+  }
+
+  // #NOTE: the phi of a variable the loop does not change is
+  // redundant, we replace it with the value entering the loop.
+  // removing one phi may make another redundant, so we repeat
+  // until nothing changes.
+  llvm::DenseMap<llvm::Value *, llvm::Value *> replaced;
+  bool                                         changed = true;
+  while (changed) {
+    changed = false;
+    for (std::size_t index = 0; index < loop.phis.size(); ++index) {
+      auto *phi = loop.phis[index];
+      if (phi == nullptr) {
+        continue;
+      }
+      auto *incoming = loop.incoming[index];
+      auto *latch_value = phi->getIncomingValueForBlock(latch);
+      if (latch_value != phi && latch_value != incoming) {
+        continue;
+      }
+      phi->replaceAllUsesWith(incoming);
+      phi->eraseFromParent();
+      replaced[phi]    = incoming;
+      loop.phis[index] = nullptr;
+      changed          = true;
+    }
+  }
+
+  for (auto &value : exit) {
+    while (replaced.count(value) != 0) {
+      value = replaced[value];
+    }
+  }
+  RestoreSSAVariables(exit);
+}
+
+auto CompilationUnit::LoopMetadata(std::size_t unroll_count,
+                                   std::size_t vectorize_width)
+    -> llvm::MDNode * {
+  auto hint = [this](llvm::StringRef name, llvm::Metadata *value = nullptr) {
+    llvm::SmallVector<llvm::Metadata *, 2> operands;
+    operands.emplace_back(llvm::MDString::get(*context, name));
+    if (value != nullptr) {
+      operands.emplace_back(value);
+    }
+    return llvm::MDNode::get(*context, operands);
+  };
+  auto constant = [](llvm::Constant *value) {
+    return llvm::ConstantAsMetadata::get(value);
+  };
+
+  // #NOTE: the first operand of a loop id is the loop id itself,
+  // which is what keeps distinct loops from being merged.
+  auto placeholder = llvm::MDNode::getTemporary(*context, {});
+  llvm::SmallVector<llvm::Metadata *, 4> operands;
+  operands.emplace_back(placeholder.get());
+  operands.emplace_back(hint("llvm.loop.mustprogress"));
+  if (unroll_count != 0) {
+    operands.emplace_back(
+        hint("llvm.loop.unroll.count",
+             constant(instruction_builder->getInt32(
+                 static_cast<uint32_t>(unroll_count)))));
+  }
+  if (vectorize_width != 0) {
+    operands.emplace_back(
+        hint("llvm.loop.vectorize.enable",
+             constant(instruction_builder->getTrue())));
+    operands.emplace_back(
+        hint("llvm.loop.vectorize.width",
+             constant(instruction_builder->getInt32(
+                 static_cast<uint32_t>(vectorize_width)))));
+  }
+
+  auto *loop = llvm::MDNode::getDistinct(*context, operands);
+  loop->replaceOperandWith(0, loop);
+  return loop;
+}
+
 /******************************* Allocation *******************************/
 auto CompilationUnit::AllocateGlobalText(std::string_view name,
                                          std::string_view text)
     -> llvm::GlobalVariable * {
-  // #TODO: ensure that globally allocated text is unique per module.
-  // (and later between modules being combined) ((we can accomplish
-  //  this with a llvm::StringMap<std::string_view>, where the value
-  //  being looked up is the global strings name.))
-  auto *type = LLVMTextType(text.size());
-  auto *init = ConstantText(text);
-  return AllocateGlobal(name, type, init);
+  // #NOTE: globally allocated text is unique per module, the name
+  // is only used when the text is first allocated.
+  // (text is not yet unique between modules being combined, though
+  //  as the globals are unnamed_addr the linker may merge them.)
+  auto [found, inserted] = global_text.try_emplace(text, nullptr);
+  if (!inserted) {
+    return found->second;
+  }
+  auto *type   = LLVMTextType(text.size());
+  auto *init   = ConstantText(text);
+  auto *global = AllocateGlobal(name, type, init);
+  global->setConstant(true);
+  global->setLinkage(llvm::GlobalValue::PrivateLinkage);
+  global->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+  found->second = global;
+  return global;
+}
+
+auto CompilationUnit::AllocateConstantGlobal(llvm::Constant *initializer)
+    -> llvm::GlobalVariable * {
+  // #NOTE: private unnamed_addr constants with identical
+  // initializers are merged by the optimizer.
+  auto *global = new llvm::GlobalVariable(*module, // NOLINT
+                                          initializer->getType(),
+                                          /* isConstant */ true,
+                                          llvm::GlobalValue::PrivateLinkage,
+                                          initializer,
+                                          "constant");
+  global->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+  global->setAlignment(TypeAlignment(initializer->getType()));
+  return global;
 }
 
 auto CompilationUnit::AllocateGlobal(std::string_view name,
@@ -459,6 +901,16 @@ auto CompilationUnit::Load(llvm::Type *type, llvm::Value *source)
     return source;
   }
 
+  // #NOTE: a vector may be loaded from any element of an array,
+  // so it is only ever as aligned as it's elements.
+  if (auto *vector_type = llvm::dyn_cast<llvm::FixedVectorType>(type);
+      vector_type != nullptr) {
+    return instruction_builder->CreateAlignedLoad(
+        type,
+        source,
+        TypeAlignment(vector_type->getElementType()));
+  }
+
   return instruction_builder->CreateLoad(type, source);
 }
 
@@ -466,7 +918,13 @@ void CompilationUnit::Store(llvm::Type  *type,
                             llvm::Value *source,
                             llvm::Value *destination) {
   // #RULE we can only store single value types
-  if (type->isSingleValueType()) {
+  if (auto *vector_type = llvm::dyn_cast<llvm::FixedVectorType>(type);
+      vector_type != nullptr) {
+    instruction_builder->CreateAlignedStore(
+        source,
+        destination,
+        TypeAlignment(vector_type->getElementType()));
+  } else if (type->isSingleValueType()) {
     instruction_builder->CreateStore(source, destination);
   } else {
     // #RULE store copies source into destination.
@@ -477,17 +935,35 @@ void CompilationUnit::Store(llvm::Type  *type,
 void CompilationUnit::StoreAggregate(llvm::Type  *type,
                                      llvm::Value *source,
                                      llvm::Value *destination) {
+  // #NOTE: a constant which is a pointer, such as a global variable,
+  // is the address of the aggregate rather than the aggregate itself,
+  // so it is copied from like any other address.
   if (auto *const_source = llvm::dyn_cast<llvm::Constant>(source);
-      const_source != nullptr) {
+      const_source != nullptr && !const_source->getType()->isPointerTy()) {
     StoreConstAggregate(type, const_source, destination);
   } else {
     StoreValueAggregate(type, source, destination);
   }
 }
 
+// #NOTE: every aggregate within the language is plain
+// data, so any aggregate may be copied bytewise.
+// small aggregates are still stored per element, as that is
+// what the optimizer would turn the memcpy back into anyways.
 void CompilationUnit::StoreConstAggregate(llvm::Type     *type,
                                           llvm::Constant *source,
                                           llvm::Value    *destination) {
+  if (auto size = TypeAllocSize(type); size > aggregate_memcpy_threshold) {
+    auto alignment = TypeAlignment(type);
+    if (source->isNullValue()) {
+      CreateMemSetInline(destination, alignment, ConstantCharacter(0), size);
+    } else {
+      auto *constant = AllocateConstantGlobal(source);
+      CreateMemCpyInline(destination, alignment, constant, alignment, size);
+    }
+    return;
+  }
+
   if (auto *array_type = llvm::dyn_cast<llvm::ArrayType>(type);
       array_type != nullptr) {
     auto       *element_type = array_type->getElementType();
@@ -540,6 +1016,12 @@ void CompilationUnit::StoreConstAggregate(llvm::Type     *type,
 void CompilationUnit::StoreValueAggregate(llvm::Type  *type,
                                           llvm::Value *source,
                                           llvm::Value *destination) {
+  if (auto size = TypeAllocSize(type); size > aggregate_memcpy_threshold) {
+    auto alignment = TypeAlignment(type);
+    CreateMemCpyInline(destination, alignment, source, alignment, size);
+    return;
+  }
+
   if (auto *array_type = llvm::dyn_cast<llvm::ArrayType>(type);
       array_type != nullptr) {
     std::size_t size         = array_type->getNumElements();
@@ -668,7 +1150,7 @@ auto CompilationUnit::PtrToSliceElement(llvm::StructType *slice_type,
                                         llvm::Value      *slice_ptr,
                                         llvm::Value *index) -> llvm::Value * {
   auto [size, offset, ptr] = LoadSlice(slice_type, slice_ptr);
-  BoundsCheck(size, offset, ptr);
+  BoundsCheck(size, offset, index);
   return CreateInBoundsGEP(element_type, ptr, {index});
 }
 
@@ -769,7 +1251,13 @@ auto CompilationUnit::PtrToArrayElement(llvm::StructType *array_type,
                                         llvm::Value *index) -> llvm::Value * {
   auto *buffer_type   = array_type->getTypeAtIndex(1);
   auto [size, buffer] = LoadArray(array_type, array_ptr);
-  BoundsCheck(size, index);
+  // #RULE a constant index below the static size of the
+  // array needs no runtime bounds check.
+  auto *constant_index = llvm::dyn_cast<llvm::ConstantInt>(index);
+  if ((constant_index == nullptr) ||
+      constant_index->getValue().uge(buffer_type->getArrayNumElements())) {
+    BoundsCheck(size, index);
+  }
   return CreateInBoundsGEP(buffer_type, buffer, {ConstantSize(0), index});
 }
 
@@ -801,6 +1289,56 @@ void CompilationUnit::StoreArrayElement(llvm::StructType *array_type,
   Store(element_type, source, element_ptr);
 }
 
+/* Vectors */
+auto CompilationUnit::PtrToArrayLanes(llvm::StructType *array_type,
+                                      llvm::Value      *array_ptr,
+                                      llvm::Value      *index,
+                                      std::size_t lanes) -> llvm::Value * {
+  assert(lanes > 0);
+  auto *buffer_type   = array_type->getTypeAtIndex(1);
+  auto  num_elements  = buffer_type->getArrayNumElements();
+  auto [size, buffer] = LoadArray(array_type, array_ptr);
+  assert(lanes <= num_elements);
+  // #RULE a constant index whose last lane is below the static
+  // size of the array needs no runtime bounds check.
+  auto *constant_index = llvm::dyn_cast<llvm::ConstantInt>(index);
+  if ((constant_index == nullptr) ||
+      constant_index->getValue().ugt(num_elements - lanes)) {
+    BoundsCheck(size, index);
+    if (lanes > 1) {
+      BoundsCheck(size, CreateAdd(index, ConstantInteger(lanes - 1)));
+    }
+  }
+  return CreateInBoundsGEP(buffer_type, buffer, {ConstantSize(0), index});
+}
+
+auto CompilationUnit::PtrToSliceLanes(llvm::StructType *slice_type,
+                                      llvm::Type       *element_type,
+                                      llvm::Value      *slice_ptr,
+                                      llvm::Value      *index,
+                                      std::size_t lanes) -> llvm::Value * {
+  assert(lanes > 0);
+  auto [size, offset, ptr] = LoadSlice(slice_type, slice_ptr);
+  BoundsCheck(size, offset, index);
+  if (lanes > 1) {
+    BoundsCheck(size,
+                offset,
+                CreateAdd(index, ConstantInteger(lanes - 1)));
+  }
+  return CreateInBoundsGEP(element_type, ptr, {index});
+}
+
+auto CompilationUnit::LaneIndex(llvm::FixedVectorType *vector_type,
+                                llvm::Value *index) -> llvm::Value * {
+  auto  length         = vector_type->getNumElements();
+  auto *constant_index = llvm::dyn_cast<llvm::ConstantInt>(index);
+  if ((constant_index == nullptr) ||
+      constant_index->getValue().uge(length)) {
+    BoundsCheck(ConstantSize(length), index);
+  }
+  return index;
+}
+
 auto CompilationUnit::PtrToStructElement(llvm::StructType *struct_type,
                                          llvm::Value      *struct_ptr,
                                          unsigned index) -> llvm::Value * {
@@ -828,24 +1366,41 @@ void CompilationUnit::StoreStructElement(llvm::StructType *struct_type,
 /***************************** Error Handling *****************************/
 
 void CompilationUnit::BoundsCheck(llvm::Value *upper, llvm::Value *index) {
-  auto *lower = ConstantInteger(0);
-  // if ((upper <= index) || (index < 0))
-  //    RuntimeError()
-  auto *over  = CreateICmpSLE(upper, index);
-  auto *under = CreateICmpSGT(lower, index);
-  auto *check = CreateOr(over, under);
-
-  auto *out_bounds = CreateAndInsertBasicBlock("out_bounds");
+  if (!DoBoundsChecks()) {
+    return;
+  }
+  // #NOTE: sizes are never negative, so (index <u upper)
+  // is equivalent to ((0 <= index) && (index < upper))
+  RuntimeCheck(CreateICmpULT(index, upper), "bounds", "index out of bounds");
+}
+
+void CompilationUnit::BoundsCheck(llvm::Value *upper,
+                                  llvm::Value *offset,
+                                  llvm::Value *index) {
+  auto *new_index = CreateAdd(offset, index, "bounds_check");
+  BoundsCheck(upper, new_index);
+}
+
+void CompilationUnit::RuntimeCheck(llvm::Value     *condition,
+                                   std::string_view kind,
+                                   std::string_view description) {
+  // if (condition) in_bounds else out_bounds
+  auto *out_bounds = CreateBasicBlock("out_bounds");
   auto *in_bounds  = CreateBasicBlock("in_bounds");
 
-  CreateCondBr(check, out_bounds, in_bounds);
+  // #NOTE: these are the weights clang gives __builtin_expect
+  llvm::MDBuilder metadata{*context};
+  CreateCondBr(condition,
+               in_bounds,
+               out_bounds,
+               metadata.createBranchWeights(2000, 1));
+  InsertBasicBlock(out_bounds);
   SetInsertionPoint(out_bounds);
 
-  RuntimeError("index out of bounds", ConstantInteger(1));
-  // #NOTE: this instruction is dead code, but is
-  // necessary for the control flow graph of the
-  // function.
-  CreateBr(in_bounds);
+  RuntimeError(kind, description, ConstantInteger(1));
+  // #NOTE: RuntimeError never returns, marking that
+  // is what allows checks to be hoisted out of loops.
+  CreateUnreachable();
 
   // set up calling code to insert code
   // after the branch.
@@ -853,20 +1408,53 @@ void CompilationUnit::BoundsCheck(llvm::Value *upper, llvm::Value *index) {
   SetInsertionPoint(in_bounds);
 }
 
-void CompilationUnit::BoundsCheck(llvm::Value *upper,
-                                  llvm::Value *offset,
-                                  llvm::Value *index) {
-  auto *new_index = CreateAdd(offset, index, "bounds_check");
-  BoundsCheck(upper, new_index);
+void CompilationUnit::RuntimeError(std::string_view kind,
+                                   std::string_view description,
+                                   llvm::Value     *exit_code) {
+  auto *handler = RuntimeErrorHandler(kind, description);
+  auto *code    = Cast(exit_code, LLVMSizeType(), true, true);
+  auto *call    = CreateCall(handler, {code});
+  call->setCallingConv(handler->getCallingConv());
+  call->setDoesNotReturn();
 }
 
-void CompilationUnit::RuntimeError(std::string_view description,
-                                   llvm::Value     *exit_code) {
+auto CompilationUnit::RuntimeErrorHandler(std::string_view kind,
+                                          std::string_view description)
+    -> llvm::Function * {
+  auto [found, inserted] = runtime_errors.try_emplace(kind, nullptr);
+  if (!inserted) {
+    return found->second;
+  }
+
+  auto *size_type    = LLVMSizeType();
+  auto *handler_type = LLVMFunctionType(LLVMVoidType(), {size_type});
+  auto *handler =
+      llvm::Function::Create(handler_type,
+                             llvm::Function::PrivateLinkage,
+                             llvm::Twine{"runtime.error."} + kind,
+                             *module);
+  handler->setCallingConv(llvm::CallingConv::Cold);
+  handler->setDoesNotReturn();
+  handler->setDoesNotThrow();
+  handler->addFnAttr(llvm::Attribute::Cold);
+  handler->addFnAttr(llvm::Attribute::NoInline);
+  found->second = handler;
+
+  auto  save          = GetInsertionPoint();
+  auto *save_function = current_function;
+  current_function    = handler;
+  SetInsertionPoint(CreateAndInsertBasicBlock("entry"));
+
   auto *error_text = AllocateGlobalText(Gensym(), description);
   auto *text_type  = LLVMTextType(description.size());
   auto *sys_err    = ConstantInteger(2);
   SysWriteText(sys_err, text_type, error_text);
-  SysExit(exit_code);
+  SysExit(handler->getArg(0));
+  CreateUnreachable();
+
+  current_function = save_function;
+  SetInsertionPoint(save);
+  return handler;
 }
 
 /***************************** System Calls *****************************/
@@ -876,67 +1464,1214 @@ auto CompilationUnit::SysWriteSlice(llvm::Value      *filenum,
     -> llvm::Value * {
   auto [size, offset, buffer] = LoadSlice(slice_type, slice_pointer);
   auto *length                = CreateSub(size, offset);
-  return SysWrite(filenum, length, buffer);
+  return RuntimeWrite(filenum, length, buffer);
 }
 
 auto CompilationUnit::SysWriteText(llvm::Value      *filenum,
                                    llvm::StructType *text_type,
                                    llvm::Value *text_pointer) -> llvm::Value * {
   auto [text_size, text_ptr] = LoadText(text_type, text_pointer);
-  return SysWrite(filenum, text_size, text_ptr);
+  return RuntimeWrite(filenum, text_size, text_ptr);
+}
+
+auto CompilationUnit::SysCall(std::size_t                   number,
+                              llvm::ArrayRef<llvm::Value *> arguments)
+    -> llvm::Value * {
+  // the x86-64 linux syscall calling convention
+  static constexpr std::array<const char *, 6> registers =
+      {"{rdi}", "{rsi}", "{rdx}", "{r10}", "{r8}", "{r9}"};
+  assert(arguments.size() <= registers.size());
+  auto *size_type = LLVMSizeType();
+
+  std::string                constraints{"={rax},{rax}"};
+  std::vector<llvm::Type *>  argument_types{size_type};
+  std::vector<llvm::Value *> actual_arguments{ConstantInteger(number)};
+  for (std::size_t index = 0; index < arguments.size(); ++index) {
+    constraints += ",";
+    constraints += registers.at(index);
+    argument_types.emplace_back(arguments[index]->getType());
+    actual_arguments.emplace_back(arguments[index]);
+  }
+  // the syscall instruction itself clobbers rcx and r11
+  constraints += ",~{rcx},~{r11},~{memory}";
+
+  auto *syscall_type = LLVMFunctionType(size_type, argument_types);
+  auto *syscall      = InlineAsm(syscall_type, "syscall", constraints);
+  return CreateCall(syscall, actual_arguments);
 }
 
 auto CompilationUnit::SysWrite(llvm::Value *filenum,
                                llvm::Value *size,
                                llvm::Value *buffer) -> llvm::Value * {
+  auto *size_type = LLVMSizeType();
+  auto *fd        = Cast(filenum, size_type, true, true);
+  return SysCall(1, {fd, buffer, size});
+}
+
+void CompilationUnit::SysExit(llvm::Value *exit_code) {
+  auto *size_type = LLVMSizeType();
+  auto *void_type = LLVMVoidType();
+
+  // #RULE buffered output is flushed before the program exits
+  RuntimeFlushAll();
+
+  if (DoProfileGenerate()) {
+    ProfileWrite();
+  }
+
+  if (DoRun()) {
+    auto *exit_type = LLVMFunctionType(void_type, {size_type});
+    auto  jit_exit  = module->getOrInsertFunction(jit_exit_symbol, exit_type);
+    auto *exit_fn   = llvm::cast<llvm::Function>(jit_exit.getCallee());
+    exit_fn->setDoesNotReturn();
+    exit_fn->setDoesNotThrow();
+    CreateCall(jit_exit, {Cast(exit_code, size_type, true, true)});
+    return;
+  }
+
+  // we cast the exit code to a size_type (u64)
+  auto *return_value = Cast(exit_code, size_type, true, true);
+  SysCall(60, {return_value});
+}
+
+/***************************** Runtime *****************************/
+/*
+  The runtime buffers output written to stdout and stderr
+  within the module itself, such that a program printing in
+  a loop does not make a syscall per write.
+
+  the buffers are flushed when they are full, explicitly by
+  RuntimeFlush, and before the program exits within SysExit.
+  when a write does not fit within the buffer, the buffer
+  and the write are handed to a single writev syscall.
+  a write or writev which writes fewer bytes than asked is
+  continued until every byte is written, or the write fails.
+
+  the runtime is emitted into the module the first time it
+  is used, as private functions:
+    void runtime.write(i64 filedes, ptr buffer, i64 size)
+    void runtime.write_all(i64 filedes, ptr buffer, i64 size)
+    void runtime.flush(i64 filedes)
+    void runtime.flush_all()
+  writes to file descriptors other than stdout and
+  stderr are not buffered.
+*/
+auto CompilationUnit::RuntimeWrite(llvm::Value *filedes,
+                                   llvm::Value *size,
+                                   llvm::Value *buffer) -> llvm::Value * {
+  auto *write = RuntimeFunction(runtime_write_symbol);
+  auto *fd    = Cast(filedes, LLVMSizeType(), true, true);
+  return CreateCall(write, {fd, buffer, size});
+}
+
+void CompilationUnit::RuntimeFlush(llvm::Value *filedes) {
+  auto *flush = RuntimeFunction(runtime_flush_symbol);
+  auto *fd    = Cast(filedes, LLVMSizeType(), true, true);
+  CreateCall(flush, {fd});
+}
+
+void CompilationUnit::RuntimeFlushAll() {
+  CreateCall(RuntimeFunction(runtime_flush_all_symbol));
+}
+
+auto CompilationUnit::RuntimeFunction(std::string_view name)
+    -> llvm::Function * {
+  if (auto *function = runtime_functions.lookup(name); function != nullptr) {
+    return function;
+  }
+  EmitRuntime();
+  auto *function = runtime_functions.lookup(name);
+  assert(function != nullptr);
+  return function;
+}
+
+void CompilationUnit::EmitRuntime() {
   auto *size_type    = LLVMSizeType();
   auto *pointer_type = LLVMPointerType();
+  auto *void_type    = LLVMVoidType();
+  // one buffer for stdout and one for stderr
+  constexpr uint64_t stream_count  = 2;
+  auto              *buffer_type   = LLVMBareArrayType(LLVMCharacterType(),
+                                          runtime_buffer_size);
+  auto              *buffers_type  = LLVMBareArrayType(buffer_type, stream_count);
+  auto              *lengths_type  = LLVMBareArrayType(size_type, stream_count);
+  auto              *iovec_type    = llvm::StructType::get(*context,
+                                                   {pointer_type, size_type});
+  auto              *iovecs_type   = LLVMBareArrayType(iovec_type, 2);
+  auto              *capacity      = ConstantSize(runtime_buffer_size);
+
+  auto CreateGlobal = [&](llvm::Type *type, std::string_view name) {
+    auto *global = new llvm::GlobalVariable(*module, // NOLINT
+                                            type,
+                                            /* isConstant */ false,
+                                            llvm::GlobalValue::PrivateLinkage,
+                                            llvm::Constant::getNullValue(type),
+                                            name);
+    global->setAlignment(TypeAlignment(size_type));
+    return global;
+  };
+  auto *buffers = CreateGlobal(buffers_type, "runtime.buffers");
+  auto *lengths = CreateGlobal(lengths_type, "runtime.lengths");
+
+  auto CreateRuntimeFunction = [&](std::string_view             name,
+                                   llvm::ArrayRef<llvm::Type *> arguments) {
+    auto *function = llvm::Function::Create(LLVMFunctionType(void_type,
+                                                             arguments),
+                                            llvm::Function::PrivateLinkage,
+                                            name,
+                                            *module);
+    function->setDoesNotThrow();
+    runtime_functions[name] = function;
+    return function;
+  };
+  auto *write     = CreateRuntimeFunction(runtime_write_symbol,
+                                          {size_type, pointer_type, size_type});
+  auto *write_all = CreateRuntimeFunction(runtime_write_all_symbol,
+                                          {size_type, pointer_type, size_type});
+  auto *flush     = CreateRuntimeFunction(runtime_flush_symbol, {size_type});
+  auto *flush_all = CreateRuntimeFunction(runtime_flush_all_symbol, {});
+
+  auto  save          = GetInsertionPoint();
+  auto *save_function = current_function;
+
+  // stream = filedes - 1
+  // if (stream <u 2) buffered else unbuffered
+  auto SelectStream = [&](llvm::Value      *filedes,
+                          llvm::BasicBlock *buffered,
+                          llvm::BasicBlock *unbuffered) {
+    auto *stream      = CreateSub(filedes, ConstantSize(1), "stream");
+    auto *is_buffered = CreateICmpULT(stream, ConstantSize(stream_count));
+    CreateCondBr(is_buffered, buffered, unbuffered);
+    return stream;
+  };
+  auto StreamBuffer = [&](llvm::Value *stream) {
+    return CreateInBoundsGEP(buffers_type,
+                             buffers,
+                             {ConstantSize(0), stream, ConstantSize(0)});
+  };
+  auto StreamLength = [&](llvm::Value *stream) {
+    return CreateInBoundsGEP(lengths_type, lengths, {ConstantSize(0), stream});
+  };
 
-  auto *mov_rdi_type = LLVMFunctionType(size_type, {size_type});
-  auto *mov_rsi_type = LLVMFunctionType(pointer_type, {pointer_type});
-  auto *mov_rdx_type = LLVMFunctionType(size_type, {size_type});
-  auto *mov_rax_type = LLVMFunctionType(size_type, {});
-  auto *syscall_type = LLVMFunctionType(size_type, {});
+  { // void runtime.write(i64 filedes, ptr data, i64 size)
+    current_function     = write;
+    auto *filedes        = write->getArg(0);
+    auto *data           = write->getArg(1);
+    auto *size           = write->getArg(2);
+    auto *entry          = CreateAndInsertBasicBlock("entry");
+    auto *buffered       = CreateAndInsertBasicBlock("buffered");
+    auto *unbuffered     = CreateAndInsertBasicBlock("unbuffered");
+    auto *append         = CreateAndInsertBasicBlock("append");
+    auto *batch          = CreateAndInsertBasicBlock("batch");
+    auto *partial        = CreateAndInsertBasicBlock("partial");
+    auto *rest_of_buffer = CreateAndInsertBasicBlock("rest_of_buffer");
+    auto *rest_of_data   = CreateAndInsertBasicBlock("rest_of_data");
+    auto *done           = CreateAndInsertBasicBlock("done");
+
+    SetInsertionPoint(entry);
+    auto *iovecs = CreateAlloca(iovecs_type, nullptr, "iovecs");
+    auto *stream = SelectStream(filedes, buffered, unbuffered);
+
+    SetInsertionPoint(unbuffered);
+    CreateCall(write_all, {filedes, data, size});
+    CreateRetVoid();
+
+    SetInsertionPoint(buffered);
+    auto *buffer     = StreamBuffer(stream);
+    auto *length_ptr = StreamLength(stream);
+    auto *length     = CreateLoad(size_type, length_ptr, "length");
+    auto *new_length = CreateAdd(length, size, "new_length");
+    auto *fits = instruction_builder->CreateICmpULE(new_length, capacity);
+    CreateCondBr(fits, append, batch);
+
+    // #NOTE: the copy is a rep movsb rather than a memcpy, so the
+    // runtime does not depend upon the memory runtime.
+    SetInsertionPoint(append);
+    auto *end = CreateInBoundsGEP(LLVMCharacterType(), buffer, {length});
+    RepMovsb(end, data, size);
+    CreateStore(new_length, length_ptr);
+    CreateRetVoid();
+
+    // writev(filedes, {{buffer, length}, {data, size}}, 2)
+    SetInsertionPoint(batch);
+    StoreStructElement(iovec_type,
+                       CreateConstInBoundsGEP2_64(iovecs_type, iovecs, 0, 0),
+                       buffer,
+                       0);
+    StoreStructElement(iovec_type,
+                       CreateConstInBoundsGEP2_64(iovecs_type, iovecs, 0, 0),
+                       length,
+                       1);
+    StoreStructElement(iovec_type,
+                       CreateConstInBoundsGEP2_64(iovecs_type, iovecs, 0, 1),
+                       data,
+                       0);
+    StoreStructElement(iovec_type,
+                       CreateConstInBoundsGEP2_64(iovecs_type, iovecs, 0, 1),
+                       size,
+                       1);
+    auto *written = SysCall(20, {filedes, iovecs, ConstantSize(2)});
+    CreateStore(ConstantSize(0), length_ptr);
+    CreateCondBr(CreateICmpEQ(written, new_length), done, partial);
+
+    // a short writev leaves the end of the buffer and the data,
+    // or the end of the data, to be written. a failed writev
+    // wrote nothing.
+    SetInsertionPoint(partial);
+    auto *failed = CreateICmpSLT(written, ConstantSize(0));
+    auto *count  = CreateSelect(failed, ConstantSize(0), written, "count");
+    CreateCondBr(CreateICmpULT(count, length), rest_of_buffer, rest_of_data);
+
+    SetInsertionPoint(rest_of_buffer);
+    CreateCall(write_all,
+               {filedes,
+                CreateInBoundsGEP(LLVMCharacterType(), buffer, {count}),
+                CreateSub(length, count)});
+    CreateCall(write_all, {filedes, data, size});
+    CreateRetVoid();
+
+    SetInsertionPoint(rest_of_data);
+    auto *skipped = CreateSub(count, length, "skipped");
+    CreateCall(write_all,
+               {filedes,
+                CreateInBoundsGEP(LLVMCharacterType(), data, {skipped}),
+                CreateSub(size, skipped)});
+    CreateRetVoid();
+
+    SetInsertionPoint(done);
+    CreateRetVoid();
+  }
 
-  auto *mov_rdi = [&]() {
-    if (llvm::isa<llvm::ConstantInt>(filenum)) {
-      return InlineAsm(mov_rdi_type, "mov rdi, $1", "={rdi},i");
-    }
-    return InlineAsm(mov_rdi_type, "mov rdi, $1", "={rdi},r");
-  }();
-  auto *mov_rsi = InlineAsm(mov_rsi_type, "mov rsi, $1", "={rsi},r");
-  auto *mov_rdx = InlineAsm(mov_rdx_type, "mov rdx, $1", "={rdx},r");
-  auto *mov_rax = InlineAsm(mov_rax_type, "mov rax, 1", "={rax}");
-  auto *syscall = InlineAsm(syscall_type, "syscall", "={rax}");
+  { // void runtime.write_all(i64 filedes, ptr data, i64 size)
+    // linux returns -EINTR from a write interrupted by a signal
+    constexpr int64_t eintr = 4;
+    current_function        = write_all;
+    auto *filedes           = write_all->getArg(0);
+    auto *entry             = CreateAndInsertBasicBlock("entry");
+    auto *loop              = CreateAndInsertBasicBlock("loop");
+    auto *write_BB          = CreateAndInsertBasicBlock("write");
+    auto *check             = CreateAndInsertBasicBlock("check");
+    auto *advance           = CreateAndInsertBasicBlock("advance");
+    auto *done              = CreateAndInsertBasicBlock("done");
+
+    SetInsertionPoint(entry);
+    CreateBr(loop);
+
+    SetInsertionPoint(loop);
+    auto *data = CreatePHI(pointer_type, 3, "data");
+    auto *size = CreatePHI(size_type, 3, "size");
+    data->addIncoming(write_all->getArg(1), entry);
+    size->addIncoming(write_all->getArg(2), entry);
+    CreateCondBr(CreateICmpEQ(size, ConstantSize(0)), done, write_BB);
+
+    // an interrupted write is retried, any other failure
+    // gives up on the rest of the bytes.
+    SetInsertionPoint(write_BB);
+    auto *written     = SysWrite(filedes, size, data);
+    auto *interrupted = CreateICmpEQ(
+        written,
+        llvm::ConstantInt::getSigned(size_type, -eintr));
+    data->addIncoming(data, write_BB);
+    size->addIncoming(size, write_BB);
+    CreateCondBr(interrupted, loop, check);
+
+    SetInsertionPoint(check);
+    CreateCondBr(CreateICmpSLT(written, ConstantSize(1)), done, advance);
+
+    SetInsertionPoint(advance);
+    data->addIncoming(
+        CreateInBoundsGEP(LLVMCharacterType(), data, {written}, "next_data"),
+        advance);
+    size->addIncoming(CreateSub(size, written, "next_size"), advance);
+    CreateBr(loop);
+
+    SetInsertionPoint(done);
+    CreateRetVoid();
+  }
+
+  { // void runtime.flush(i64 filedes)
+    current_function = flush;
+    auto *filedes    = flush->getArg(0);
+    auto *entry      = CreateAndInsertBasicBlock("entry");
+    auto *buffered   = CreateAndInsertBasicBlock("buffered");
+    auto *nonempty   = CreateAndInsertBasicBlock("nonempty");
+    auto *done       = CreateAndInsertBasicBlock("done");
+
+    SetInsertionPoint(entry);
+    auto *stream = SelectStream(filedes, buffered, done);
+
+    SetInsertionPoint(buffered);
+    auto *length_ptr = StreamLength(stream);
+    auto *length     = CreateLoad(size_type, length_ptr, "length");
+    auto *is_empty   = CreateICmpEQ(length, ConstantSize(0));
+    CreateCondBr(is_empty, done, nonempty);
+
+    SetInsertionPoint(nonempty);
+    CreateCall(write_all, {filedes, StreamBuffer(stream), length});
+    CreateStore(ConstantSize(0), length_ptr);
+    CreateBr(done);
+
+    SetInsertionPoint(done);
+    CreateRetVoid();
+  }
 
-  CreateCall(mov_rax, {});
-  CreateCall(mov_rdi, {filenum});
-  CreateCall(mov_rdx, {size});
-  CreateCall(mov_rsi, {buffer});
-  return CreateCall(syscall, {});
+  { // void runtime.flush_all()
+    current_function = flush_all;
+    SetInsertionPoint(CreateAndInsertBasicBlock("entry"));
+    CreateCall(flush, {ConstantSize(1)});
+    CreateCall(flush, {ConstantSize(2)});
+    CreateRetVoid();
+  }
+
+  current_function = save_function;
+  SetInsertionPoint(save);
 }
 
-void CompilationUnit::SysExit(llvm::Value *exit_code) {
+/***************************** Heap *****************************/
+/*
+  The heap is emitted into the module the first time it is
+  used, like the runtime, as private functions:
+    ptr  runtime.arena_alloc(i64 bytes)
+    void runtime.arena_reset()
+    ptr  runtime.pool_alloc(i64 bytes)
+    void runtime.pool_free(ptr block, i64 bytes)
+
+  the arena and the pool each reserve heap_reserve_size bytes of
+  address space with a single mmap on first use, which the kernel
+  backs with zeroed pages only as they are touched. the arena
+  then bump allocates from it's region, and is reset by handing
+  the used pages back with madvise(MADV_DONTNEED), so the pages
+  read as zero again the next time they are touched.
+
+  the pool rounds each request up to a power of two size class,
+  from heap_smallest_size_class to heap_largest_size_class, and
+  keeps a free list per size class threaded through the freed
+  blocks. a block is taken from it's free list when possible,
+  and bump allocated from the pool's region otherwise. requests
+  larger than the largest size class are mapped and unmapped
+  individually.
+
+  every allocation is zeroed, so a pink program never observes
+  the contents of memory it did not write.
+*/
+auto CompilationUnit::ArenaAllocate(llvm::Type  *element_type,
+                                    llvm::Value *count) -> llvm::Value * {
+  auto *allocate = HeapFunction(heap_arena_alloc_symbol);
+  return CreateCall(allocate, {HeapSize(element_type, count)});
+}
+
+void CompilationUnit::ArenaReset() {
+  CreateCall(HeapFunction(heap_arena_reset_symbol));
+}
+
+auto CompilationUnit::PoolAllocate(llvm::Type  *element_type,
+                                   llvm::Value *count) -> llvm::Value * {
+  auto *allocate = HeapFunction(heap_pool_alloc_symbol);
+  return CreateCall(allocate, {HeapSize(element_type, count)});
+}
+
+void CompilationUnit::PoolFree(llvm::Type  *element_type,
+                               llvm::Value *buffer,
+                               llvm::Value *count) {
+  auto *free = HeapFunction(heap_pool_free_symbol);
+  CreateCall(free, {buffer, ElementsSize(element_type, count)});
+}
+
+/*
+  the size in bytes of count elements of element_type, checking
+  that the size fits within the reserved region, which also
+  rules out negative counts and overflow of the multiplication.
+*/
+auto CompilationUnit::HeapSize(llvm::Type *element_type, llvm::Value *count)
+    -> llvm::Value * {
+  auto  element_size = std::max(TypeAllocSize(element_type), uint64_t{1});
+  auto *limit        = ConstantSize(heap_reserve_size / element_size);
+  RuntimeCheck(CreateICmpULE(count, limit), "size", "allocation too large");
+  return ElementsSize(element_type, count);
+}
+
+auto CompilationUnit::HeapFunction(std::string_view name) -> llvm::Function * {
+  if (auto *function = runtime_functions.lookup(name); function != nullptr) {
+    return function;
+  }
+  EmitHeapRuntime();
+  auto *function = runtime_functions.lookup(name);
+  assert(function != nullptr);
+  return function;
+}
+
+void CompilationUnit::EmitHeapRuntime() {
+  // the linux x86-64 mmap, munmap and madvise flags we use
+  constexpr uint64_t prot_read_write  = 0x3;
+  constexpr uint64_t map_private_anon = 0x22;
+  constexpr uint64_t map_noreserve    = 0x4000;
+  constexpr uint64_t madv_dontneed    = 4;
+  // the heap hands out blocks aligned to the smallest size class
+  constexpr uint64_t alignment        = heap_smallest_size_class;
+
+  // the size classes are the powers of two between the bounds
+  constexpr uint64_t smallest_bits = std::countr_zero(heap_smallest_size_class);
+  constexpr uint64_t class_count =
+      std::countr_zero(heap_largest_size_class) - smallest_bits + 1;
+
+  auto *size_type       = LLVMSizeType();
+  auto *pointer_type    = LLVMPointerType();
+  auto *void_type       = LLVMVoidType();
+  auto *free_lists_type = LLVMBareArrayType(pointer_type, class_count);
+
+  auto CreateGlobal = [&](llvm::Type *type, std::string_view name) {
+    auto *global = new llvm::GlobalVariable(*module, // NOLINT
+                                            type,
+                                            /* isConstant */ false,
+                                            llvm::GlobalValue::PrivateLinkage,
+                                            llvm::Constant::getNullValue(type),
+                                            name);
+    global->setAlignment(TypeAlignment(size_type));
+    return global;
+  };
+  auto *arena_base = CreateGlobal(pointer_type, "heap.arena_base");
+  auto *arena_used = CreateGlobal(size_type, "heap.arena_used");
+  auto *pool_base  = CreateGlobal(pointer_type, "heap.pool_base");
+  auto *pool_used  = CreateGlobal(size_type, "heap.pool_used");
+  auto *free_lists = CreateGlobal(free_lists_type, "heap.free_lists");
+
+  auto CreateHeapFunction = [&](std::string_view             name,
+                                llvm::Type                  *result,
+                                llvm::ArrayRef<llvm::Type *> arguments) {
+    auto *function = llvm::Function::Create(LLVMFunctionType(result,
+                                                             arguments),
+                                            llvm::Function::PrivateLinkage,
+                                            name,
+                                            *module);
+    function->setDoesNotThrow();
+    runtime_functions[name] = function;
+    return function;
+  };
+  auto *arena_alloc = CreateHeapFunction(heap_arena_alloc_symbol,
+                                         pointer_type,
+                                         {size_type});
+  auto *arena_reset = CreateHeapFunction(heap_arena_reset_symbol,
+                                         void_type,
+                                         {});
+  auto *pool_alloc  = CreateHeapFunction(heap_pool_alloc_symbol,
+                                         pointer_type,
+                                         {size_type});
+  auto *pool_free   = CreateHeapFunction(heap_pool_free_symbol,
+                                         void_type,
+                                         {pointer_type, size_type});
+  for (auto *allocate : {arena_alloc, pool_alloc}) {
+    allocate->addRetAttr(llvm::Attribute::NoAlias);
+    allocate->addRetAttr(llvm::Attribute::NonNull);
+  }
+
+  auto  save          = GetInsertionPoint();
+  auto *save_function = current_function;
+
+  // mmap(nullptr, length, PROT_READ | PROT_WRITE,
+  //      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0)
+  auto Map = [&](llvm::Value *length) {
+    auto *result = SysCall(9,
+                           {ConstantSize(0),
+                            length,
+                            ConstantSize(prot_read_write),
+                            ConstantSize(map_private_anon | map_noreserve),
+                            ConstantSize(~uint64_t{0}),
+                            ConstantSize(0)});
+    // #NOTE: the kernel returns errors as -4095 through -1
+    auto *mapped = CreateICmpULE(result, ConstantSize(~uint64_t{4095}));
+    RuntimeCheck(mapped, "memory", "out of memory");
+    return instruction_builder->CreateIntToPtr(result, pointer_type);
+  };
+
+  // allocates bytes from the region [base, base + heap_reserve_size),
+  // reserving the region if this is the first allocation.
+  auto BumpAllocate = [&](llvm::GlobalVariable *base_ptr,
+                          llvm::GlobalVariable *used_ptr,
+                          llvm::Value          *bytes,
+                          std::string_view      kind,
+                          std::string_view      exhausted) {
+    auto *reserve = CreateAndInsertBasicBlock("reserve");
+    auto *bump    = CreateAndInsertBasicBlock("bump");
+
+    auto *entry    = GetInsertionPoint().block;
+    auto *old_base = CreateLoad(pointer_type, base_ptr, "base");
+    auto *is_reserved =
+        CreateICmpNE(old_base, llvm::ConstantPointerNull::get(pointer_type));
+    CreateCondBr(is_reserved, bump, reserve);
+
+    SetInsertionPoint(reserve);
+    auto *new_base = Map(ConstantSize(heap_reserve_size));
+    CreateStore(new_base, base_ptr);
+    auto *reserved = GetInsertionPoint().block;
+    CreateBr(bump);
+
+    SetInsertionPoint(bump);
+    auto *base = CreatePHI(pointer_type, 2, "base");
+    base->addIncoming(old_base, entry);
+    base->addIncoming(new_base, reserved);
+    // used += (bytes + (alignment - 1)) & ~(alignment - 1)
+    auto *used     = CreateLoad(size_type, used_ptr, "used");
+    auto *rounded  = CreateAnd(CreateAdd(bytes, ConstantSize(alignment - 1)),
+                               ConstantSize(~(alignment - 1)),
+                               "rounded");
+    auto *new_used = CreateAdd(used, rounded, "new_used");
+    RuntimeCheck(CreateICmpULE(new_used, ConstantSize(heap_reserve_size)),
+                 kind,
+                 exhausted);
+    CreateStore(new_used, used_ptr);
+    return CreateInBoundsGEP(LLVMCharacterType(), base, {used});
+  };
+
+  // bits = 64 - ctlz(max(bytes, smallest) - 1)
+  // class_size = 1 << bits
+  // free_list = &free_lists[bits - log2(smallest)]
+  auto SizeClass = [&](llvm::Value *bytes) {
+    auto *smallest  = ConstantSize(heap_smallest_size_class);
+    auto *is_small  = CreateICmpULT(bytes, smallest);
+    auto *clamped   = CreateSelect(is_small, smallest, bytes);
+    auto *is_poison = instruction_builder->getFalse();
+    auto *leading_zeros =
+        instruction_builder->CreateIntrinsic(llvm::Intrinsic::ctlz,
+                                             {size_type},
+                                             {CreateSub(clamped,
+                                                        ConstantSize(1)),
+                                              is_poison});
+    auto *bits       = CreateSub(ConstantSize(64), leading_zeros, "bits");
+    auto *class_size = CreateShl(ConstantSize(1), bits, "class_size");
+    auto *index      = CreateSub(bits, ConstantSize(smallest_bits), "index");
+    auto *free_list  = CreateInBoundsGEP(free_lists_type,
+                                        free_lists,
+                                        {ConstantSize(0), index});
+    return std::make_pair(class_size, free_list);
+  };
+
+  auto *largest = ConstantSize(heap_largest_size_class);
+
+  { // ptr runtime.arena_alloc(i64 bytes)
+    current_function = arena_alloc;
+    SetInsertionPoint(CreateAndInsertBasicBlock("entry"));
+    CreateRet(BumpAllocate(arena_base,
+                           arena_used,
+                           arena_alloc->getArg(0),
+                           "arena",
+                           "arena exhausted"));
+  }
+
+  { // void runtime.arena_reset()
+    current_function = arena_reset;
+    auto *entry      = CreateAndInsertBasicBlock("entry");
+    auto *nonempty   = CreateAndInsertBasicBlock("nonempty");
+    auto *done       = CreateAndInsertBasicBlock("done");
+
+    SetInsertionPoint(entry);
+    auto *used = CreateLoad(size_type, arena_used, "used");
+    CreateCondBr(CreateICmpEQ(used, ConstantSize(0)), done, nonempty);
+
+    SetInsertionPoint(nonempty);
+    auto *base = CreateLoad(pointer_type, arena_base, "base");
+    SysCall(28, {base, used, ConstantSize(madv_dontneed)});
+    CreateStore(ConstantSize(0), arena_used);
+    CreateBr(done);
+
+    SetInsertionPoint(done);
+    CreateRetVoid();
+  }
+
+  { // ptr runtime.pool_alloc(i64 bytes)
+    current_function = pool_alloc;
+    auto *bytes      = pool_alloc->getArg(0);
+    auto *entry      = CreateAndInsertBasicBlock("entry");
+    auto *large      = CreateAndInsertBasicBlock("large");
+    auto *small      = CreateAndInsertBasicBlock("small");
+    auto *reuse      = CreateAndInsertBasicBlock("reuse");
+    auto *carve      = CreateAndInsertBasicBlock("carve");
+
+    SetInsertionPoint(entry);
+    CreateCondBr(CreateICmpUGT(bytes, largest), large, small);
+
+    SetInsertionPoint(large);
+    CreateRet(Map(bytes));
+
+    SetInsertionPoint(small);
+    auto [class_size, free_list] = SizeClass(bytes);
+    auto *head = CreateLoad(pointer_type, free_list, "head");
+    auto *is_empty =
+        CreateICmpEQ(head, llvm::ConstantPointerNull::get(pointer_type));
+    CreateCondBr(is_empty, carve, reuse);
+
+    SetInsertionPoint(reuse);
+    CreateStore(CreateLoad(pointer_type, head, "next"), free_list);
+    // #NOTE: the block is zeroed with rep stosb rather than a memset,
+    // which would lower to a call of memset.
+    RepStosb(head, ConstantSize(0), class_size);
+    CreateRet(head);
+
+    SetInsertionPoint(carve);
+    CreateRet(BumpAllocate(
+        pool_base, pool_used, class_size, "pool", "pool exhausted"));
+  }
+
+  { // void runtime.pool_free(ptr block, i64 bytes)
+    current_function = pool_free;
+    auto *block      = pool_free->getArg(0);
+    auto *bytes      = pool_free->getArg(1);
+    auto *entry      = CreateAndInsertBasicBlock("entry");
+    auto *nonnull    = CreateAndInsertBasicBlock("nonnull");
+    auto *large      = CreateAndInsertBasicBlock("large");
+    auto *small      = CreateAndInsertBasicBlock("small");
+    auto *done       = CreateAndInsertBasicBlock("done");
+
+    // #NOTE: freeing a null block does nothing, which is
+    // what makes freeing an already freed slice harmless.
+    SetInsertionPoint(entry);
+    auto *is_null =
+        CreateICmpEQ(block, llvm::ConstantPointerNull::get(pointer_type));
+    CreateCondBr(is_null, done, nonnull);
+
+    SetInsertionPoint(nonnull);
+    CreateCondBr(CreateICmpUGT(bytes, largest), large, small);
+
+    SetInsertionPoint(large);
+    SysCall(11, {block, bytes});
+    CreateBr(done);
+
+    // push the block onto the free list of it's size class
+    SetInsertionPoint(small);
+    auto *free_list = SizeClass(bytes).second;
+    CreateStore(CreateLoad(pointer_type, free_list, "head"), block);
+    CreateStore(block, free_list);
+    CreateBr(done);
+
+    SetInsertionPoint(done);
+    CreateRetVoid();
+  }
+
+  current_function = save_function;
+  SetInsertionPoint(save);
+}
+
+/***************************** Memory *****************************/
+/*
+  The bulk operations on arrays and slices are lowered to the
+  llvm memory intrinsics, which the backend lowers to calls of
+  memcpy, memmove and memset whenever the size is not a small
+  constant. the optimizer also forms those calls from loops it
+  recognizes as copies or fills.
+
+  a linked pink program has no libc to provide them, so when
+  linking we define them within the module, along with bcmp:
+    ptr memcpy(ptr destination, ptr source, i64 size)
+    ptr memmove(ptr destination, ptr source, i64 size)
+    ptr memset(ptr destination, i32 value, i64 size)
+    i32 bcmp(ptr left, ptr right, i64 size)
+  the copies and the fill are each a single rep movsb or
+  rep stosb, which run at close to the bandwidth of memory
+  on any x86-64 with fast string operations.
+*/
+auto CompilationUnit::ElementsSize(llvm::Type  *element_type,
+                                   llvm::Value *count) -> llvm::Value * {
+  return CreateMul(count,
+                   ConstantSize(TypeAllocSize(element_type)),
+                   "bytes",
+                   /* no_unsigned_wrap */ true,
+                   /* no_signed_wrap */ true);
+}
+
+void CompilationUnit::CopyElements(llvm::Type  *element_type,
+                                   llvm::Value *destination,
+                                   llvm::Value *source,
+                                   llvm::Value *count) {
+  auto alignment = TypeAlignment(element_type);
+  CreateMemCpy(destination,
+               alignment,
+               source,
+               alignment,
+               ElementsSize(element_type, count));
+}
+
+void CompilationUnit::MoveElements(llvm::Type  *element_type,
+                                   llvm::Value *destination,
+                                   llvm::Value *source,
+                                   llvm::Value *count) {
+  auto alignment = TypeAlignment(element_type);
+  CreateMemMove(destination,
+                alignment,
+                source,
+                alignment,
+                ElementsSize(element_type, count));
+}
+
+/*
+  a fill of single byte elements, or of zero, is a memset.
+  any other fill is a loop storing the value into each element,
+  which the LoopVectorizer widens.
+*/
+void CompilationUnit::FillElements(llvm::Type  *element_type,
+                                   llvm::Value *destination,
+                                   llvm::Value *value,
+                                   llvm::Value *count) {
+  auto  alignment = TypeAlignment(element_type);
+  auto *constant  = llvm::dyn_cast<llvm::Constant>(value);
+  if ((constant != nullptr) && constant->isNullValue()) {
+    CreateMemSet(destination,
+                 ConstantCharacter(0),
+                 ElementsSize(element_type, count),
+                 alignment);
+    return;
+  }
+
+  if (element_type->isIntegerTy() && (TypeAllocSize(element_type) == 1)) {
+    CreateMemSet(destination,
+                 Cast(value, LLVMCharacterType(), false, false),
+                 count,
+                 alignment);
+    return;
+  }
+
+  auto *index_type = LLVMSizeType();
+  auto *header_BB  = CreateAndInsertBasicBlock("fill_header");
+  auto *body_BB    = CreateAndInsertBasicBlock("fill_body");
+  auto *end_BB     = CreateAndInsertBasicBlock("fill_end");
+
+  auto *preheader_BB = GetInsertionPoint().block;
+  CreateBr(header_BB);
+
+  SetInsertionPoint(header_BB);
+  auto *index = CreatePHI(index_type, 2, "index");
+  index->addIncoming(ConstantSize(0), preheader_BB);
+  CreateCondBr(CreateICmpULT(index, count), body_BB, end_BB);
+
+  SetInsertionPoint(body_BB);
+  auto *address = CreateInBoundsGEP(element_type, destination, {index});
+  Store(element_type, value, address);
+  auto *next = CreateAdd(index,
+                         ConstantSize(1),
+                         "next",
+                         /* no_unsigned_wrap */ true,
+                         /* no_signed_wrap */ true);
+  index->addIncoming(next, GetInsertionPoint().block);
+  CreateBr(header_BB);
+
+  SetInsertionPoint(end_BB);
+}
+
+auto CompilationUnit::CompareElements(llvm::Type  *element_type,
+                                      llvm::Value *left,
+                                      llvm::Value *right,
+                                      llvm::Value *count) -> llvm::Value * {
+  auto *compare = MemoryFunction(memory_compare_symbol);
+  auto *result =
+      CreateCall(compare, {left, right, ElementsSize(element_type, count)});
+  return CreateICmpEQ(result, instruction_builder->getInt32(0));
+}
+
+// rep movsb copies rcx bytes from [rsi] to [rdi], forward
+// or backward as the direction flag is clear or set.
+void CompilationUnit::RepMovsb(llvm::Value *destination,
+                               llvm::Value *source,
+                               llvm::Value *size,
+                               bool         backward) {
+  auto *size_type    = LLVMSizeType();
+  auto *pointer_type = LLVMPointerType();
+  auto *result_type  = llvm::StructType::get(*context,
+                                            {pointer_type,
+                                             pointer_type,
+                                             size_type});
+  auto *asm_type =
+      LLVMFunctionType(result_type, {pointer_type, pointer_type, size_type});
+  auto *movsb = InlineAsm(asm_type,
+                          backward ? "std\n\trep movsb\n\tcld" : "rep movsb",
+                          "={rdi},={rsi},={rcx},0,1,2,~{memory},~{dirflag}");
+  // a backward copy begins from the last byte of each
+  if (backward) {
+    auto *last  = CreateSub(size, ConstantSize(1), "last");
+    destination = CreateInBoundsGEP(LLVMCharacterType(), destination, {last});
+    source      = CreateInBoundsGEP(LLVMCharacterType(), source, {last});
+  }
+  CreateCall(movsb, {destination, source, size});
+}
+
+// rep stosb stores al into rcx bytes from [rdi]
+void CompilationUnit::RepStosb(llvm::Value *destination,
+                               llvm::Value *value,
+                               llvm::Value *size) {
+  auto *size_type    = LLVMSizeType();
+  auto *pointer_type = LLVMPointerType();
+  auto *result_type  = llvm::StructType::get(*context,
+                                            {pointer_type, size_type});
+  auto *asm_type =
+      LLVMFunctionType(result_type, {pointer_type, size_type, size_type});
+  auto *stosb = InlineAsm(asm_type,
+                          "rep stosb",
+                          "={rdi},={rcx},0,1,{rax},~{memory},~{dirflag}");
+  CreateCall(stosb, {destination, size, value});
+}
+
+auto CompilationUnit::MemoryFunction(std::string_view name)
+    -> llvm::Function * {
+  if (auto *function = runtime_functions.lookup(name); function != nullptr) {
+    return function;
+  }
+
+  auto *size_type    = LLVMSizeType();
+  auto *pointer_type = LLVMPointerType();
+  auto *int32_type   = instruction_builder->getInt32Ty();
+
+  // #NOTE: a program cannot define a function with one of these
+  // names (see Function::Typecheck), so they are never renamed.
+  auto DeclareMemoryFunction = [&](std::string_view             name,
+                                   llvm::Type                  *result,
+                                   llvm::ArrayRef<llvm::Type *> arguments) {
+    auto *function =
+        llvm::Function::Create(LLVMFunctionType(result, arguments),
+                               llvm::Function::ExternalLinkage,
+                               name,
+                               *module);
+    assert(function->getName() == llvm::StringRef{name});
+    function->setDoesNotThrow();
+    // #NOTE: the optimizer must not recognize the body of
+    // memcpy as a call to memcpy.
+    function->addFnAttr("no-builtins");
+    runtime_functions[name] = function;
+  };
+  DeclareMemoryFunction(memory_copy_symbol,
+                        pointer_type,
+                        {pointer_type, pointer_type, size_type});
+  DeclareMemoryFunction(memory_move_symbol,
+                        pointer_type,
+                        {pointer_type, pointer_type, size_type});
+  DeclareMemoryFunction(memory_set_symbol,
+                        pointer_type,
+                        {pointer_type, int32_type, size_type});
+  DeclareMemoryFunction(memory_compare_symbol,
+                        int32_type,
+                        {pointer_type, pointer_type, size_type});
+
+  auto *function = runtime_functions.lookup(name);
+  assert(function != nullptr);
+  return function;
+}
+
+void CompilationUnit::EmitMemoryRuntime() {
+  auto *size_type = LLVMSizeType();
+
+  auto *copy    = MemoryFunction(memory_copy_symbol);
+  auto *move    = MemoryFunction(memory_move_symbol);
+  auto *set     = MemoryFunction(memory_set_symbol);
+  auto *compare = MemoryFunction(memory_compare_symbol);
+  if (!copy->isDeclaration()) {
+    return;
+  }
+
+  auto  save          = GetInsertionPoint();
+  auto *save_function = current_function;
+
+  { // ptr memcpy(ptr destination, ptr source, i64 size)
+    current_function = copy;
+    SetInsertionPoint(CreateAndInsertBasicBlock("entry"));
+    RepMovsb(copy->getArg(0), copy->getArg(1), copy->getArg(2));
+    CreateRet(copy->getArg(0));
+  }
+
+  { // ptr memmove(ptr destination, ptr source, i64 size)
+    current_function  = move;
+    auto *destination = move->getArg(0);
+    auto *source      = move->getArg(1);
+    auto *size        = move->getArg(2);
+    auto *entry       = CreateAndInsertBasicBlock("entry");
+    auto *forward     = CreateAndInsertBasicBlock("forward");
+    auto *backward    = CreateAndInsertBasicBlock("backward");
+
+    // #NOTE: the copy must run backward if and only if the
+    // destination begins within the source, which is
+    // ((destination - source) <u size)
+    SetInsertionPoint(entry);
+    auto *distance = CreateSub(
+        instruction_builder->CreatePtrToInt(destination, size_type),
+        instruction_builder->CreatePtrToInt(source, size_type),
+        "distance");
+    CreateCondBr(CreateICmpULT(distance, size), backward, forward);
+
+    SetInsertionPoint(forward);
+    RepMovsb(destination, source, size);
+    CreateRet(destination);
+
+    SetInsertionPoint(backward);
+    RepMovsb(destination, source, size, /* backward */ true);
+    CreateRet(destination);
+  }
+
+  { // ptr memset(ptr destination, i32 value, i64 size)
+    current_function = set;
+    SetInsertionPoint(CreateAndInsertBasicBlock("entry"));
+    auto *value = Cast(set->getArg(1), size_type, false, false);
+    RepStosb(set->getArg(0), value, set->getArg(2));
+    CreateRet(set->getArg(0));
+  }
+
+  { // i32 bcmp(ptr left, ptr right, i64 size)
+    current_function = compare;
+    auto *left       = compare->getArg(0);
+    auto *right      = compare->getArg(1);
+    auto *size       = compare->getArg(2);
+    auto *word_type  = LLVMSizeType();
+    auto  word_size  = TypeAllocSize(word_type);
+    auto *entry      = CreateAndInsertBasicBlock("entry");
+    auto *words      = CreateAndInsertBasicBlock("words");
+    auto *word       = CreateAndInsertBasicBlock("word");
+    auto *bytes      = CreateAndInsertBasicBlock("bytes");
+    auto *byte       = CreateAndInsertBasicBlock("byte");
+    auto *differ     = CreateAndInsertBasicBlock("differ");
+    auto *equal      = CreateAndInsertBasicBlock("equal");
+
+    // compare a word at a time, then the remaining bytes
+    auto Differs = [&](llvm::Type *type, llvm::Value *offset) {
+      auto *left_address  = CreateInBoundsGEP(LLVMCharacterType(),
+                                             left,
+                                             {offset});
+      auto *right_address = CreateInBoundsGEP(LLVMCharacterType(),
+                                              right,
+                                              {offset});
+      return CreateICmpNE(
+          CreateAlignedLoad(type, left_address, llvm::Align(1)),
+          CreateAlignedLoad(type, right_address, llvm::Align(1)));
+    };
+
+    SetInsertionPoint(entry);
+    CreateBr(words);
+
+    SetInsertionPoint(words);
+    auto *word_offset = CreatePHI(size_type, 2, "word_offset");
+    word_offset->addIncoming(ConstantSize(0), entry);
+    auto *word_end = CreateAdd(word_offset, ConstantSize(word_size));
+    CreateCondBr(CreateICmpULE(word_end, size), word, bytes);
+
+    SetInsertionPoint(word);
+    word_offset->addIncoming(word_end, word);
+    CreateCondBr(Differs(word_type, word_offset), differ, words);
+
+    SetInsertionPoint(bytes);
+    auto *byte_offset = CreatePHI(size_type, 2, "byte_offset");
+    byte_offset->addIncoming(word_offset, words);
+    CreateCondBr(CreateICmpULT(byte_offset, size), byte, equal);
+
+    SetInsertionPoint(byte);
+    byte_offset->addIncoming(CreateAdd(byte_offset, ConstantSize(1)), byte);
+    CreateCondBr(Differs(LLVMCharacterType(), byte_offset), differ, bytes);
+
+    SetInsertionPoint(differ);
+    CreateRet(instruction_builder->getInt32(1));
+
+    SetInsertionPoint(equal);
+    CreateRet(instruction_builder->getInt32(0));
+  }
+
+  current_function = save_function;
+  SetInsertionPoint(save);
+}
+
+/***************************** Profiling *****************************/
+/*
+  pink programs are not linked against libc, and so not against
+  compiler-rt's profile runtime either. Instead, when instrumenting
+  we emit the small part of that runtime we need into the module:
+  a function which writes the counters into a raw profile
+  (the format llvm-profdata merge reads) using syscalls, called
+  from SysExit.
+
+  the instrumentation lowering places the profile data, counters,
+  and names into the sections __llvm_prf_data, __llvm_prf_cnts,
+  and __llvm_prf_names, and lld defines __start_ and __stop_ symbols
+  bounding each of them.
+*/
+// #NOTE: the raw profile header below is written as specified
+// by version 8 of the format. if llvm changes the format this
+// must be updated to match.
+static_assert(INSTR_PROF_RAW_VERSION == 8);
+
+namespace {
+// the layout of a single profile data record, as the lowering emits it.
+using IntPtrT = uint64_t;
+using llvm::IPVK_Last;
+struct ProfileData {
+#define INSTR_PROF_DATA(Type, LLVMType, Name, Initializer) Type Name;
+#include "llvm/ProfileData/InstrProfData.inc"
+};
+} // namespace
+
+void CompilationUnit::ProfileWrite() {
+  auto *write = runtime_functions.lookup(profile_write_symbol);
+  if (write == nullptr) {
+    EmitProfileRuntime();
+    write = runtime_functions.lookup(profile_write_symbol);
+  }
+  assert(write != nullptr);
+  CreateCall(write);
+}
+
+void CompilationUnit::EmitProfileRuntime() {
   auto *size_type    = LLVMSizeType();
+  auto *pointer_type = LLVMPointerType();
   auto *void_type    = LLVMVoidType();
-  auto *mov_rax_type = LLVMFunctionType(size_type, {});
-  auto *mov_rdi_type = LLVMFunctionType(size_type, {size_type});
-  auto *syscall_type = LLVMFunctionType(void_type, {});
 
-  auto *mov_rdi = [&]() {
-    if (llvm::isa<llvm::ConstantInt>(exit_code)) {
-      return InlineAsm(mov_rdi_type, "mov rdi, $1", "={rdi},i");
-    }
-    return InlineAsm(mov_rdi_type, "mov rdi, $1", "={rdi},r");
-  }();
-  auto *mov_rax = InlineAsm(mov_rax_type, "mov rax, 60", "={rax}");
-  auto *syscall = InlineAsm(syscall_type, "syscall", "");
-  // we cast the exit code to a size_type (u64)
-  auto *return_value = Cast(exit_code, size_type, true, true);
+  // defining the runtime hook variable tells the lowering
+  // that the module provides its own profile runtime.
+  auto *runtime_hook =
+      new llvm::GlobalVariable(*module, // NOLINT
+                               instruction_builder->getInt32Ty(),
+                               /* isConstant */ true,
+                               llvm::GlobalValue::ExternalLinkage,
+                               instruction_builder->getInt32(0),
+                               llvm::getInstrProfRuntimeHookVarName());
+  runtime_hook->setVisibility(llvm::GlobalValue::HiddenVisibility);
+
+  // we do not collect value profiles, these are what the lowering
+  // of value profiling sites calls, so they do nothing.
+  auto *value_profile_type = LLVMFunctionType(
+      void_type,
+      {size_type, pointer_type, instruction_builder->getInt32Ty()});
+  for (const auto *name :
+       {"__llvm_profile_instrument_target", "__llvm_profile_instrument_memop"}) {
+    auto *stub = llvm::Function::Create(value_profile_type,
+                                        llvm::Function::PrivateLinkage,
+                                        name,
+                                        *module);
+    stub->setDoesNotThrow();
+    auto *entry = llvm::BasicBlock::Create(*context, "entry", stub);
+    llvm::ReturnInst::Create(*context, entry);
+    // the calls do not exist until the lowering runs.
+    llvm::appendToCompilerUsed(*module, {stub});
+  }
 
-  CreateCall(mov_rdi, {return_value});
-  CreateCall(mov_rax, {});
-  CreateCall(syscall);
+  auto SectionBound = [&](std::string_view name) {
+    auto *bound = new llvm::GlobalVariable(*module, // NOLINT
+                                           instruction_builder->getInt8Ty(),
+                                           /* isConstant */ true,
+                                           llvm::GlobalValue::ExternalLinkage,
+                                           nullptr,
+                                           name);
+    bound->setVisibility(llvm::GlobalValue::HiddenVisibility);
+    return bound;
+  };
+  auto *data_begin     = SectionBound("__start___llvm_prf_data");
+  auto *data_end       = SectionBound("__stop___llvm_prf_data");
+  auto *counters_begin = SectionBound("__start___llvm_prf_cnts");
+  auto *counters_end   = SectionBound("__stop___llvm_prf_cnts");
+  auto *names_begin    = SectionBound("__start___llvm_prf_names");
+  auto *names_end      = SectionBound("__stop___llvm_prf_names");
+
+  auto *filename = new llvm::GlobalVariable(
+      *module, // NOLINT
+      llvm::ConstantDataArray::getString(*context,
+                                         GetProfileGenerateFile().string())
+          ->getType(),
+      /* isConstant */ true,
+      llvm::GlobalValue::PrivateLinkage,
+      llvm::ConstantDataArray::getString(*context,
+                                         GetProfileGenerateFile().string()),
+      "profile.filename");
+  filename->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+
+  auto *padding_type = LLVMBareArrayType(instruction_builder->getInt8Ty(), 8);
+  auto *padding =
+      new llvm::GlobalVariable(*module, // NOLINT
+                               padding_type,
+                               /* isConstant */ true,
+                               llvm::GlobalValue::PrivateLinkage,
+                               llvm::Constant::getNullValue(padding_type),
+                               "profile.padding");
+
+  // void profile.write()
+  auto *write = llvm::Function::Create(LLVMFunctionType(void_type, {}),
+                                       llvm::Function::PrivateLinkage,
+                                       profile_write_symbol,
+                                       *module);
+  runtime_functions[profile_write_symbol] = write;
+  write->setDoesNotThrow();
+  write->addFnAttr(llvm::Attribute::Cold);
+  write->addFnAttr(llvm::Attribute::NoInline);
+
+  auto  save          = GetInsertionPoint();
+  auto *save_function = current_function;
+  current_function    = write;
+
+  auto *entry  = CreateAndInsertBasicBlock("entry");
+  auto *opened = CreateAndInsertBasicBlock("opened");
+  auto *done   = CreateAndInsertBasicBlock("done");
+
+  // open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644)
+  SetInsertionPoint(entry);
+  constexpr std::size_t open_flags = 01 | 0100 | 01000;
+  constexpr std::size_t open_mode  = 0644;
+  auto *fd     = SysCall(2,
+                      {filename,
+                       ConstantSize(open_flags),
+                       ConstantSize(open_mode)});
+  auto *failed = instruction_builder->CreateICmpSLT(fd, ConstantSize(0));
+  CreateCondBr(failed, done, opened);
+
+  SetInsertionPoint(opened);
+  auto Address = [&](llvm::Constant *bound) {
+    return instruction_builder->CreatePtrToInt(bound, size_type);
+  };
+  auto *data_size     = CreateSub(Address(data_end), Address(data_begin));
+  auto *counters_size = CreateSub(Address(counters_end),
+                                  Address(counters_begin));
+  auto *names_size    = CreateSub(Address(names_end), Address(names_begin));
+  // the padding needed to align a section to 8 bytes within the file
+  auto Padding = [&](llvm::Value *size) {
+    return instruction_builder->CreateAnd(CreateSub(ConstantSize(0), size),
+                                          ConstantSize(7));
+  };
+
+  std::array<llvm::Value *, 11> header_fields = {
+      // Magic
+      ConstantSize(INSTR_PROF_RAW_MAGIC_64),
+      // Version
+      ConstantSize(INSTR_PROF_RAW_VERSION | VARIANT_MASK_IR_PROF),
+      // BinaryIdsSize
+      ConstantSize(0),
+      // DataSize, the number of data records
+      instruction_builder->CreateUDiv(data_size,
+                                      ConstantSize(sizeof(ProfileData))),
+      // PaddingBytesBeforeCounters
+      ConstantSize(0),
+      // CountersSize, the number of counters
+      instruction_builder->CreateUDiv(counters_size,
+                                      ConstantSize(sizeof(uint64_t))),
+      // PaddingBytesAfterCounters
+      Padding(counters_size),
+      // NamesSize
+      names_size,
+      // CountersDelta
+      CreateSub(Address(counters_begin), Address(data_begin)),
+      // NamesDelta
+      Address(names_begin),
+      // ValueKindLast
+      ConstantSize(IPVK_Last),
+  };
+  auto *header_type = LLVMBareArrayType(size_type, header_fields.size());
+  auto *header      = CreateAlloca(header_type, nullptr, "header");
+  for (std::size_t index = 0; index < header_fields.size(); ++index) {
+    CreateStore(header_fields.at(index),
+                CreateConstInBoundsGEP2_64(header_type, header, 0, index));
+  }
+
+  SysWrite(fd, ConstantSize(TypeAllocSize(header_type)), header);
+  SysWrite(fd, data_size, data_begin);
+  SysWrite(fd, counters_size, counters_begin);
+  SysWrite(fd, Padding(counters_size), padding);
+  SysWrite(fd, names_size, names_begin);
+  SysWrite(fd, Padding(names_size), padding);
+  // close(fd)
+  SysCall(3, {fd});
+  CreateBr(done);
+
+  SetInsertionPoint(done);
+  CreateRetVoid();
+
+  current_function = save_function;
+  SetInsertionPoint(save);
 }
 
 /***************************** Casting *****************************/
@@ -961,6 +2696,10 @@ auto CompilationUnit::Cast(llvm::Value *source,
                            bool         is_target_signed) -> llvm::Value * {
   auto *source_type = source->getType();
 
+  if (source_type->isFloatingPointTy()) {
+    return CastFloatTo(source, source_type, target_type, is_target_signed);
+  }
+
   if (is_source_signed) {
     if (auto *from_type = llvm::dyn_cast<llvm::IntegerType>(source_type)) {
       return CastIntegerTo(source, from_type, target_type, is_target_signed);
@@ -979,16 +2718,20 @@ auto CompilationUnit::Cast(llvm::Value *source,
   FatalError("unsupported type cast");
 }
 
-auto CompilationUnit::CastIntegerTo(llvm::Value       *source,
-                                    llvm::IntegerType *from_type,
-                                    llvm::Type        *target_type,
-                                    bool is_target_signed) -> llvm::Value * {
+auto CompilationUnit::CastIntegerTo(
+    llvm::Value          *source,
+    llvm::IntegerType    *from_type,
+    llvm::Type           *target_type,
+    [[maybe_unused]] bool is_target_signed) -> llvm::Value * {
+  // #NOTE: the signedness of the source alone decides how the
+  // value is extended, so -1 as an i8 becomes the all ones u64.
   if (auto *to_type = llvm::dyn_cast<llvm::IntegerType>(target_type);
       to_type != nullptr) {
-    if (is_target_signed) {
-      return CastSExt(source, from_type, to_type);
-    }
-    return CastZExt(source, from_type, to_type);
+    return CastSExt(source, from_type, to_type);
+  }
+
+  if (target_type->isFloatingPointTy()) {
+    return instruction_builder->CreateSIToFP(source, target_type);
   }
 
   FatalError("unsupported type cast");
@@ -1004,6 +2747,41 @@ auto CompilationUnit::CastUnsignedIntegerTo(
     return CastZExt(source, from_type, to_type);
   }
 
+  if (target_type->isFloatingPointTy()) {
+    return instruction_builder->CreateUIToFP(source, target_type);
+  }
+
+  FatalError("unsupported type cast");
+}
+
+auto CompilationUnit::CastFloatTo(llvm::Value *source,
+                                  llvm::Type  *from_type,
+                                  llvm::Type  *to_type,
+                                  bool is_target_signed) -> llvm::Value * {
+  if (to_type->isFloatingPointTy()) {
+    auto from_bitwidth = from_type->getPrimitiveSizeInBits();
+    auto to_bitwidth   = to_type->getPrimitiveSizeInBits();
+
+    if (from_bitwidth < to_bitwidth) {
+      return instruction_builder->CreateFPExt(source, to_type);
+    }
+
+    if (from_bitwidth > to_bitwidth) {
+      return instruction_builder->CreateFPTrunc(source, to_type);
+    }
+    // from_bitwidth == to_bitwidth
+    return source;
+  }
+
+  // #NOTE: a value which is out of range of the target type
+  // converts to poison, as it is undefined behavior in C.
+  if (to_type->isIntegerTy()) {
+    if (is_target_signed) {
+      return instruction_builder->CreateFPToSI(source, to_type);
+    }
+    return instruction_builder->CreateFPToUI(source, to_type);
+  }
+
   FatalError("unsupported type cast");
 }
 
@@ -73,9 +73,15 @@ constexpr auto Error::CodeToErrText(Error::Code code) -> const char * {
   case Error::Code::UnknownOption:
     return "Unknown option";
   case Error::Code::BadOptimizationLevel:
-    return "Unknown optimization level, use one of [0, 1, 2, 3, s, z]";
+    return "Unknown optimization level, use one of [0, 1, 2, 3, s, z, g]";
+  case Error::Code::BadBoundsChecksMode:
+    return "Unknown bounds checks mode, use one of [off, on, hoisted]";
+  case Error::Code::BadRelocationModel:
+    return "Unknown relocation model, use one of [static, pic]";
   case Error::Code::MissingInputFile:
     return "Missing input file";
+  case Error::Code::IncompatibleOptions:
+    return "Incompatible options";
 
   // syntax error descriptions
   case Error::Code::EndOfFile:
@@ -123,7 +129,15 @@ constexpr auto Error::CodeToErrText(Error::Code code) -> const char * {
   case Error::Code::MissingWhile:
     return "Syntax Error: Missing 'while' in while expression";
   case Error::Code::MissingDo:
-    return "Syntax Error: Missing 'do' in while expression";
+    return "Syntax Error: Missing 'do' in loop expression";
+  case Error::Code::MissingForId:
+    return "Syntax Error: Expected identifier for for expression";
+  case Error::Code::MissingIn:
+    return "Syntax Error: Missing 'in' in for expression";
+  case Error::Code::MissingLoopHintNum:
+    return "Syntax Error: Missing quantity in loop hint";
+  case Error::Code::UnknownLoopHint:
+    return "Syntax Error: Unknown loop hint, expected 'unroll' or 'vectorize'";
   case Error::Code::UnknownBinop:
     return "Syntax Error: Unknown binary operator";
   case Error::Code::UnknownUnop:
@@ -132,6 +146,9 @@ constexpr auto Error::CodeToErrText(Error::Code code) -> const char * {
     return "Syntax Error: Unknown basic token. expected to parse a term";
   case Error::Code::UnknownTypeToken:
     return "Syntax Error: Unknown type token. expected to parse a type";
+  case Error::Code::BadVectorType:
+    return "Syntax Error: A vector must have at least one lane of an "
+           "integer type, a float type or [Boolean]";
   case Error::Code::BadTopLevelExpression:
     return "Syntax Error: Bad top level expression";
 
@@ -166,6 +183,15 @@ constexpr auto Error::CodeToErrText(Error::Code code) -> const char * {
            "identical type";
   case Error::Code::WhileTestTypeMismatch:
     return "Type Error: While loop's test expression must have type [Boolean]";
+  case Error::Code::ForRangeTypeMismatch:
+    return "Type Error: For loop's range bounds must have type [Integer]";
+  case Error::Code::ForSequenceNotIterable:
+    return "Type Error: For loop's sequence must be an array or a slice";
+  case Error::Code::VectorArgumentMismatch:
+    return "Type Error: A vector must be constructed from it's lanes, a "
+           "single element, or an array or slice and an index";
+  case Error::Code::VectorLaneOutOfRange:
+    return "Type Error: Vector lane index is out of range";
   case Error::Code::DotLeftIsNotATuple:
     return "Type Error: Dot operator's right hand side must be a tuple";
   case Error::Code::DotRightIsNotAnInt:
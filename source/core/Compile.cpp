@@ -17,6 +17,7 @@
 
 #include "core/Compile.h"
 #include "core/Link.h"
+#include "core/Run.h"
 
 #include "aux/Environment.h" // pink::CompilationUnit
 
@@ -43,6 +44,10 @@ auto Compile(int argc, char **argv) -> int {
     return EXIT_FAILURE;
   }
 
+  if (env.DoRun()) {
+    return Run(out, err, env);
+  }
+
   if (!env.DoLink()) {
     return EXIT_SUCCESS;
   }
@@ -15,17 +15,61 @@
 // You should have received a copy of the GNU General Public License
 // along with pink.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/raw_os_ostream.h"
 
 #include "lld/Common/Driver.h"
 
-#include "support/FatalError.h"
-
 #include "core/Link.h"
 
 namespace pink {
 /**
- * @brief Links together the object file represented by
+ * @brief Writes the given object code into an anonymous in memory file
+ *
+ * lld only accepts input by filename, so we hand it the path
+ * /proc/self/fd/N of a memfd holding the object code. This way
+ * the object code never touches the filesystem.
+ *
+ * @param object the object code
+ * @param err the stream to write errors to
+ * @return int the file descriptor of the memfd, or -1 on failure
+ */
+static auto CreateObjectMemfd(llvm::ArrayRef<char> object, std::ostream &err)
+    -> int {
+  int object_fd = memfd_create("pink_object", MFD_CLOEXEC);
+  if (object_fd < 0) {
+    err << "Couldn't create in memory object file [" << std::strerror(errno)
+        << "]\n";
+    return -1;
+  }
+
+  const char *cursor    = object.data();
+  std::size_t remaining = object.size();
+  while (remaining > 0) {
+    auto written = write(object_fd, cursor, remaining);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      err << "Couldn't write in memory object file [" << std::strerror(errno)
+          << "]\n";
+      close(object_fd);
+      return -1;
+    }
+    cursor    += written;
+    remaining -= static_cast<std::size_t>(written);
+  }
+  return object_fd;
+}
+
+/**
+ * @brief Links together the object code represented by
  * this Environment to construct an executable file.
  *
  * \todo what do we do when we want to translate multiple
@@ -40,18 +84,21 @@ namespace pink {
  */
 auto Link(std::ostream &out, std::ostream &err, const CompilationUnit &env)
     -> int {
-  // #RULE once we link we clean up the object file
-  auto remove_object_file = [&env]() {
-    std::error_code errc;
-    if (!fs::remove(env.GetObjectFile(), errc)) {
-      FatalError(errc);
-    }
-  };
+  // #NOTE: when performing link time optimization the "object"
+  // handed to lld is bitcode, which lld recognizes by its magic.
+  llvm::SmallVector<char, 0> object;
+  auto                       emitted = env.DoLinkTimeOptimization()
+                                         ? env.EmitBitcodeBuffer(object, err)
+                                         : env.EmitObjectBuffer(object, err);
+  if (emitted == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
 
-  if (!fs::exists(env.GetObjectFile())) {
-    err << "No object file [" << env.GetObjectFile() << "] exists to link.";
+  int object_fd = CreateObjectMemfd(object, err);
+  if (object_fd < 0) {
     return EXIT_FAILURE;
   }
+  std::string object_path = "/proc/self/fd/" + std::to_string(object_fd);
 
   llvm::raw_os_ostream      llvm_err = err;
   llvm::raw_os_ostream      llvm_out = out;
@@ -60,20 +107,29 @@ auto Link(std::ostream &out, std::ostream &err, const CompilationUnit &env)
                                         "elf_x86_64",
                                         "--entry",
                                         "main",
-                                        env.GetObjectFile().c_str(),
+                                        object_path.c_str(),
                                         "-o",
                                         env.GetExecutableFile().c_str()};
 
-  if (!lld::elf::link(lld_args,
-                      llvm_out,
-                      llvm_err,
-                      /* exitEarly */ false,
-                      /* disableOutput */ false)) {
-    remove_object_file();
-    return EXIT_FAILURE;
+  if (env.DoFunctionSections()) {
+    lld_args.emplace_back("--gc-sections");
   }
-  remove_object_file();
-  return EXIT_SUCCESS;
+
+  std::string lto_level;
+  if (env.DoLinkTimeOptimization()) {
+    lto_level = "--lto-O" + std::to_string(
+                                env.GetOptimizationLevel().getSpeedupLevel());
+    lld_args.emplace_back(lto_level.c_str());
+    lld_args.emplace_back("--thinlto-jobs=all");
+  }
+
+  bool linked = lld::elf::link(lld_args,
+                               llvm_out,
+                               llvm_err,
+                               /* exitEarly */ false,
+                               /* disableOutput */ false);
+  close(object_fd);
+  return linked ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 } // namespace pink
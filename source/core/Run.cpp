@@ -0,0 +1,114 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <chrono>
+#include <csetjmp>
+
+#include "llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h"
+#include "llvm/ExecutionEngine/Orc/LLJIT.h"
+#include "llvm/ExecutionEngine/Orc/ThreadSafeModule.h"
+
+#include "core/Run.h"
+
+namespace pink {
+// #NOTE: 6/2/2023
+// pink programs terminate by way of SysExit, which when
+// compiling for --run calls __pink_jit_exit instead of
+// making the exit syscall. We jump from there back into
+// Run, this is safe as jit'ed code has no destructors to
+// skip over.
+static std::jmp_buf *jit_exit_point = nullptr;
+static int64_t       jit_exit_code  = 0;
+
+[[noreturn]] static void JITExit(int64_t exit_code) {
+  jit_exit_code = exit_code;
+  std::longjmp(*jit_exit_point, 1); // NOLINT
+}
+
+auto Run(std::ostream &out, std::ostream &err, CompilationUnit &unit) -> int {
+  auto start = std::chrono::steady_clock::now();
+
+  // #NOTE: the JIT compiles for the same cpu and features as
+  // the unit's target machine, such that --march and --mattr
+  // apply to --run as they do to an object file.
+  llvm::orc::JITTargetMachineBuilder target_machine_builder{
+      unit.GetTargetTriple()};
+  target_machine_builder.setCPU(std::string{unit.GetTargetCPU()});
+  target_machine_builder.getFeatures() =
+      llvm::SubtargetFeatures{unit.GetTargetFeatures()};
+  target_machine_builder.setCodeGenOptLevel(unit.GetCodeGenOptLevel());
+
+  auto jit = llvm::orc::LLJITBuilder()
+                 .setJITTargetMachineBuilder(std::move(target_machine_builder))
+                 .create();
+  if (!jit) {
+    err << "Couldn't create the JIT [" << llvm::toString(jit.takeError())
+        << "]\n";
+    return EXIT_FAILURE;
+  }
+
+  llvm::orc::SymbolMap host_symbols;
+  host_symbols[(*jit)->mangleAndIntern(CompilationUnit::jit_exit_symbol)] =
+      llvm::JITEvaluatedSymbol(
+          llvm::pointerToJITTargetAddress(&JITExit),
+          llvm::JITSymbolFlags::Exported | llvm::JITSymbolFlags::Callable);
+
+  auto &main_dylib = (*jit)->getMainJITDylib();
+  if (auto error =
+          main_dylib.define(llvm::orc::absoluteSymbols(host_symbols))) {
+    err << "Couldn't define host symbols [" << llvm::toString(std::move(error))
+        << "]\n";
+    return EXIT_FAILURE;
+  }
+
+  auto [context, module] = unit.ReleaseModule();
+  if (auto error = (*jit)->addIRModule(
+          llvm::orc::ThreadSafeModule{std::move(module), std::move(context)})) {
+    err << "Couldn't add the module to the JIT ["
+        << llvm::toString(std::move(error)) << "]\n";
+    return EXIT_FAILURE;
+  }
+
+  // looking up main is what causes the module to be compiled.
+  auto main_address = (*jit)->lookup("main");
+  if (!main_address) {
+    err << "Couldn't find main [" << llvm::toString(main_address.takeError())
+        << "]\n";
+    return EXIT_FAILURE;
+  }
+  auto *main_function = main_address->toPtr<void (*)()>();
+
+  if (unit.DoVerbose()) {
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    out << "JIT startup latency [" << latency.count() << "us]\n";
+  }
+  // the program writes directly to the file descriptors,
+  // so anything we have buffered must come before it.
+  out.flush();
+  err.flush();
+
+  std::jmp_buf exit_point;
+  jit_exit_point = &exit_point;
+  if (setjmp(exit_point) == 0) { // NOLINT
+    main_function();
+  }
+  jit_exit_point = nullptr;
+  return static_cast<int>(jit_exit_code);
+}
+} // namespace pink
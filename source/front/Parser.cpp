@@ -124,6 +124,8 @@ auto Parser::IsBinop(Token token) -> bool {
   case Token::LessThanOrEqual:
   case Token::GreaterThan:
   case Token::GreaterThanOrEqual:
+  case Token::ShiftLeft:
+  case Token::ShiftRight:
     return true;
   default:
     return false;
@@ -135,8 +137,9 @@ auto Parser::IsBinop(Token token) -> bool {
       == !=     : 1
       < <= > >= : 2
       & |       : 3
-      + -       : 4
-      * / %     : 5
+      << >>     : 4
+      + -       : 5
+      * / %     : 6
 
   #REASON
   in short, I want [a + b * c == d * e + f]
@@ -161,13 +164,16 @@ auto Parser::Precedence(Token token) -> pink::Precedence {
   case Token::And:
   case Token::Or:
     return 3;
+  case Token::ShiftLeft:
+  case Token::ShiftRight:
+    return 4;
   case Token::Add:
   case Token::Sub:
-    return 4;
+    return 5;
   case Token::Star:
   case Token::Divide:
   case Token::Modulo:
-    return 5;
+    return 6;
   default:
     return 0;
   }
@@ -188,6 +194,8 @@ auto Parser::Associativity(Token token) -> pink::Associativity {
   case Token::LessThanOrEqual:
   case Token::GreaterThan:
   case Token::GreaterThanOrEqual:
+  case Token::ShiftLeft:
+  case Token::ShiftRight:
     return Associativity::Left;
   default:
     return Associativity::None;
@@ -425,6 +433,7 @@ auto Parser::ParseBlock(CompilationUnit &env) -> Parser::Result {
 /*
   term = conditional
        | while
+       | for
        | bind
        | affix ";"
 */
@@ -437,6 +446,10 @@ auto Parser::ParseTerm(CompilationUnit &env) -> Parser::Result {
     return ParseWhile(env);
   }
 
+  if (Peek(Token::For)) {
+    return ParseFor(env);
+  }
+
   if (Peek(Token::Var)) {
     return ParseBind(env);
   }
@@ -510,6 +523,81 @@ auto Parser::ParseWhile(CompilationUnit &env) -> Parser::Result {
   return {While::Create(whileloc, std::move(test_term), std::move(body_term))};
 }
 
+/*
+  for = "for" id "in" affix [".." affix] {hint} "do" block
+
+  hint = ("unroll" | "vectorize") integer
+*/
+auto Parser::ParseFor(CompilationUnit &env) -> Parser::Result {
+  Location lhs_loc = location;
+  nexttok(); // eat 'for'
+
+  if (!Peek(Token::Id)) {
+    return Error(Error::Code::MissingForId, location, text);
+  }
+  const auto *name = env.InternVariable(text);
+  nexttok(); // eat id
+
+  if (!Expect(Token::In)) {
+    return Error(Error::Code::MissingIn, location, text);
+  }
+
+  TRY(first_result, first_term, ParseAffix, env)
+
+  Ast::Pointer last_term;
+  if (Expect(Token::DotDot)) {
+    TRY(last_result, last, ParseAffix, env)
+    last_term = std::move(last);
+  }
+
+  // #NOTE: 'unroll' and 'vectorize' are only keywords in
+  // this position, elsewhere they are plain identifiers.
+  For::Hints hints;
+  while (Peek(Token::Id)) {
+    auto *hint = [&]() -> std::size_t * {
+      if (text == "unroll") {
+        return &hints.unroll;
+      }
+      if (text == "vectorize") {
+        return &hints.vectorize;
+      }
+      return nullptr;
+    }();
+    if (hint == nullptr) {
+      return Error(Error::Code::UnknownLoopHint, location, text);
+    }
+    nexttok(); // eat hint
+
+    if (!Peek(Token::Integer)) {
+      return Error(Error::Code::MissingLoopHintNum, location, text);
+    }
+    auto maybe_integer = ToNumber<Integer::Value>(text);
+    if (!maybe_integer) {
+      return Error{maybe_integer.GetSecond(), location, text};
+    }
+    *hint = maybe_integer.GetFirst();
+    nexttok(); // eat [0-9]+
+  }
+
+  if (!Expect(Token::Do)) {
+    return Error(Error::Code::MissingDo, location, text);
+  }
+
+  TRY(body_result, body_term, ParseBlock, env)
+
+  const Location &rhs_loc = location;
+  Location        forloc(lhs_loc.firstLine,
+                  lhs_loc.firstColumn,
+                  rhs_loc.lastLine,
+                  rhs_loc.lastColumn);
+  return {For::Create(forloc,
+                      name,
+                      std::move(first_term),
+                      std::move(last_term),
+                      std::move(body_term),
+                      hints)};
+}
+
 /*
   affix = composite "=" affix
         | composite "(" [affix {"," affix}] ")"
@@ -518,7 +606,11 @@ auto Parser::ParseWhile(CompilationUnit &env) -> Parser::Result {
 auto Parser::ParseAffix(CompilationUnit &env)
     -> Outcome<std::unique_ptr<Ast>, Error> {
   TRY(composite_result, composite, ParseComposite, env)
+  return ParseAffix(std::move(composite), env);
+}
 
+auto Parser::ParseAffix(Ast::Pointer composite, CompilationUnit &env)
+    -> Parser::Result {
   // composite "=" affix
   if (Peek(Token::Assign)) {
     return ParseAssignment(std::move(composite), env);
@@ -593,7 +685,11 @@ auto Parser::ParseApplication(Ast::Pointer callee, CompilationUnit &env)
 */
 auto Parser::ParseComposite(CompilationUnit &env) -> Parser::Result {
   TRY(accessor_result, accessor, ParseBuiltin, env)
+  return ParseComposite(std::move(accessor), env);
+}
 
+auto Parser::ParseComposite(Ast::Pointer accessor, CompilationUnit &env)
+    -> Parser::Result {
   if (IsBinop(token)) {
     return ParseInfix(std::move(accessor), 0, env);
   }
@@ -606,7 +702,14 @@ auto Parser::ParseComposite(CompilationUnit &env) -> Parser::Result {
            | basic
 */
 auto Parser::ParseBuiltin(CompilationUnit &env) -> Parser::Result {
-  TRY(left_result, left_term, ParseBasic, env)
+  TRY(basic_result, basic, ParseBasic, env)
+  return ParseBuiltin(std::move(basic), env);
+}
+
+auto Parser::ParseBuiltin(Ast::Pointer basic, CompilationUnit &env)
+    -> Parser::Result {
+  Parser::Result left_result{std::move(basic)};
+  auto          &left_term = left_result.GetFirst();
 
   do {
     if (Peek(Token::Dot)) {
@@ -631,6 +734,46 @@ auto Parser::ParseDot(Ast::Pointer left, CompilationUnit &env)
   auto lhs_loc = left->GetLocation();
   nexttok(); // eat '.'
 
+  // #NOTE: the lexer sees the indices of a nested tuple access,
+  // such as t.0.1, as the float 0.1, so we split them apart here.
+  if (Peek(Token::Float)) {
+    auto point       = text.find('.');
+    auto maybe_outer = ToNumber<Integer::Value>(text.substr(0, point));
+    auto maybe_inner = ToNumber<Integer::Value>(text.substr(point + 1));
+    if (!maybe_outer) {
+      return Error{maybe_outer.GetSecond(), location, text};
+    }
+    if (!maybe_inner) {
+      return Error{maybe_inner.GetSecond(), location, text};
+    }
+
+    Location outer_loc{location.firstLine,
+                       location.firstColumn,
+                       location.firstLine,
+                       location.firstColumn + point};
+    Location inner_loc{location.firstLine,
+                       location.firstColumn + point + 1,
+                       location.lastLine,
+                       location.lastColumn};
+    nexttok(); // eat [0-9]+ "." [0-9]+
+
+    auto outer_index = Integer::Create(outer_loc, maybe_outer.GetFirst());
+    auto inner_index = Integer::Create(inner_loc, maybe_inner.GetFirst());
+
+    Location outer_dotloc{lhs_loc.firstLine,
+                          lhs_loc.firstColumn,
+                          outer_loc.lastLine,
+                          outer_loc.lastColumn};
+    Location inner_dotloc{lhs_loc.firstLine,
+                          lhs_loc.firstColumn,
+                          inner_loc.lastLine,
+                          inner_loc.lastColumn};
+    auto     outer =
+        Dot::Create(outer_dotloc, std::move(left), std::move(outer_index));
+    return {
+        Dot::Create(inner_dotloc, std::move(outer), std::move(inner_index))};
+  }
+
   TRY(right_result, right, ParseBasic, env)
 
   const Location &rhs_loc = right->GetLocation();
@@ -831,6 +974,24 @@ auto Parser::ParseBasic(CompilationUnit &env) -> Parser::Result {
     return ParseArray(env);
   }
 
+  // #RULE a vector type appearing in basic position constructs a vector
+  case Token::VectorType: {
+    return ParseVector(env);
+  }
+
+  // #RULE a numeric type appearing in basic position converts
+  // it's argument to that type
+  case Token::IntegerType:
+  case Token::SizedIntegerType:
+  case Token::FloatType: {
+    return ParseCast(env);
+  }
+
+  // #RULE an intrinsic appearing in basic position calls it
+  case Token::Intrinsic: {
+    return ParseIntrinsic(env);
+  }
+
   // #RULE Token::Nil at basic position is the literal nil
   case Token::Nil: {
     Location lhs_loc = location;
@@ -850,6 +1011,18 @@ auto Parser::ParseBasic(CompilationUnit &env) -> Parser::Result {
     return {Integer::Create(lhs_loc, maybe_integer.GetFirst())};
   }
 
+  // #RULE Token::Float at basic position is a literal float
+  case Token::Float: {
+    Location lhs_loc     = location;
+    auto     maybe_float = ToNumber<Float::Value>(text);
+    if (!maybe_float) {
+      return Error{maybe_float.GetSecond(), location, text};
+    }
+
+    nexttok(); // eat [0-9]+ "." [0-9]+
+    return {Float::Create(lhs_loc, maybe_float.GetFirst())};
+  }
+
   // #RULE Token::True at basic position is the literal true
   case Token::True: {
     Location lhs_loc = location;
@@ -870,20 +1043,193 @@ auto Parser::ParseBasic(CompilationUnit &env) -> Parser::Result {
   } // !switch(token)
 }
 
+/*
+  vector = vector_type "(" affix {"," affix} ")"
+*/
+auto Parser::ParseVector(CompilationUnit &env) -> Result {
+  Location lhs_loc = location;
+
+  TRY(vector_type_result, vector_type, ParseVectorType, env)
+
+  if (!Expect(Token::LParen)) {
+    return Error(Error::Code::MissingLParen, location, text);
+  }
+
+  std::vector<Ast::Pointer> arguments;
+  do {
+    if (Peek(Token::Comma)) {
+      nexttok(); // eat ','
+    }
+
+    TRY(argument_result, argument, ParseAffix, env)
+
+    arguments.emplace_back(std::move(argument));
+  } while (token == Token::Comma);
+
+  if (token != Token::RParen) {
+    return Error(Error::Code::MissingRParen, location, text);
+  }
+
+  Location rhs_loc = location;
+  nexttok(); // eat ')'
+
+  Location vector_loc(lhs_loc.firstLine,
+                      lhs_loc.firstColumn,
+                      rhs_loc.lastLine,
+                      rhs_loc.lastColumn);
+  return {Vector::Create(vector_loc,
+                         llvm::cast<VectorType>(vector_type),
+                         std::move(arguments))};
+}
+
+/*
+  cast = numeric_type "(" affix ")"
+*/
+auto Parser::ParseCast(CompilationUnit &env) -> Result {
+  Location lhs_loc = location;
+
+  TRY(target_result, target, ParseType, env)
+
+  if (!Expect(Token::LParen)) {
+    return Error(Error::Code::MissingLParen, location, text);
+  }
+
+  TRY(right_result, right, ParseAffix, env)
+
+  if (token != Token::RParen) {
+    return Error(Error::Code::MissingRParen, location, text);
+  }
+
+  Location rhs_loc = location;
+  nexttok(); // eat ')'
+
+  Location cast_loc(lhs_loc.firstLine,
+                    lhs_loc.firstColumn,
+                    rhs_loc.lastLine,
+                    rhs_loc.lastColumn);
+  return {Cast::Create(cast_loc, target, std::move(right))};
+}
+
+auto Parser::ParseIntrinsic(CompilationUnit &env) -> Result {
+  Location lhs_loc = location;
+  // #NOTE: the lexer only matches the names of intrinsics
+  auto op = Intrinsic::Lookup(text);
+  assert(op.has_value());
+  nexttok(); // eat the intrinsic
+
+  if (!Expect(Token::LParen)) {
+    return Error(Error::Code::MissingLParen, location, text);
+  }
+
+  // #RULE the type argument of an intrinsic comes first
+  Type::Pointer type_argument = nullptr;
+  if (Intrinsic::TakesType(op.value())) {
+    TRY(type_result, type, ParseType, env)
+    type_argument = type;
+  }
+
+  Intrinsic::Arguments arguments;
+  if ((type_argument == nullptr) && !Peek(Token::RParen)) {
+    TRY(argument_result, argument, ParseAffix, env)
+    arguments.emplace_back(std::move(argument));
+  }
+
+  while (Expect(Token::Comma)) {
+    TRY(argument_result, argument, ParseAffix, env)
+    arguments.emplace_back(std::move(argument));
+  }
+
+  if (token != Token::RParen) {
+    return Error(Error::Code::MissingRParen, location, text);
+  }
+
+  Location rhs_loc = location;
+  nexttok(); // eat ')'
+
+  Location intrinsic_loc(lhs_loc.firstLine,
+                         lhs_loc.firstColumn,
+                         rhs_loc.lastLine,
+                         rhs_loc.lastColumn);
+  return {Intrinsic::Create(intrinsic_loc,
+                            op.value(),
+                            type_argument,
+                            std::move(arguments))};
+}
+
 auto Parser::ParseArray(CompilationUnit &env) -> Result {
   Location lhs_loc = location;
   nexttok(); // eat '['
 
+  Array::Packed             packed;
   std::vector<Ast::Pointer> elements;
 
+  // once an element which is not packed is seen, the array
+  // cannot be packed. so we unpack the literals seen so far.
+  // #NOTE: the unpacked literals are given the location of the
+  // array, as we do not track the location of each packed literal.
+  auto Unpack = [&]() {
+    elements.reserve(packed.size() + 1);
+    for (auto value : packed) {
+      elements.emplace_back(Integer::Create(lhs_loc, value));
+    }
+    packed.clear();
+  };
+
+  // #RULE an integer literal followed by ',' or ']' is packed,
+  // so long as every element before it was also packed.
+  auto ParsePackedOrAffix = [&]() -> std::optional<Error> {
+    if (!elements.empty() || !Peek(Token::Integer)) {
+      Unpack();
+      auto element_result = ParseAffix(env);
+      if (!element_result) {
+        return std::move(element_result.GetSecond());
+      }
+      elements.emplace_back(std::move(element_result.GetFirst()));
+      return {};
+    }
+
+    Location literal_loc   = location;
+    auto     maybe_integer = ToNumber<Integer::Value>(text);
+    if (!maybe_integer) {
+      return Error{maybe_integer.GetSecond(), location, text};
+    }
+    nexttok(); // eat [0-9]+
+
+    if (Peek(Token::Comma) || Peek(Token::RBracket)) {
+      packed.emplace_back(maybe_integer.GetFirst());
+      return {};
+    }
+
+    // the literal begins a larger expression, so we parse
+    // the rest of the expression the literal begins.
+    Unpack();
+
+    auto literal = Integer::Create(literal_loc, maybe_integer.GetFirst());
+    auto builtin_result = ParseBuiltin(std::move(literal), env);
+    if (!builtin_result) {
+      return std::move(builtin_result.GetSecond());
+    }
+    auto composite_result =
+        ParseComposite(std::move(builtin_result.GetFirst()), env);
+    if (!composite_result) {
+      return std::move(composite_result.GetSecond());
+    }
+    auto affix_result = ParseAffix(std::move(composite_result.GetFirst()), env);
+    if (!affix_result) {
+      return std::move(affix_result.GetSecond());
+    }
+    elements.emplace_back(std::move(affix_result.GetFirst()));
+    return {};
+  };
+
   do {
     if (Peek(Token::Comma)) {
       nexttok(); // eat ','
     }
 
-    TRY(element_result, element, ParseAffix, env)
-
-    elements.emplace_back(std::move(element));
+    if (auto error = ParsePackedOrAffix()) {
+      return std::move(error.value());
+    }
   } while (token == Token::Comma);
 
   if (token != Token::RBracket) {
@@ -897,6 +1243,9 @@ auto Parser::ParseArray(CompilationUnit &env) -> Result {
                      lhs_loc.firstColumn,
                      rhs_loc.lastLine,
                      rhs_loc.lastColumn);
+  if (elements.empty()) {
+    return {Array::Create(array_loc, std::move(packed))};
+  }
   return {Array::Create(array_loc, std::move(elements))};
 }
 
@@ -969,6 +1318,29 @@ auto Parser::ParseType(CompilationUnit &env) -> Parser::TypeResult {
     break;
   }
 
+  // #RULE Token::SizedIntegerType is one of the types i8 .. u64
+  case Token::SizedIntegerType: {
+    // #NOTE: the lexer only matches [iu](8|16|32|64)
+    bool is_signed   = text[0] == 'i';
+    auto maybe_width = ToNumber<unsigned>(text.substr(1));
+    assert(maybe_width);
+    nexttok(); // Eat [iu](8|16|32|64)
+    return {env.GetSizedIntType(annotations,
+                                maybe_width.GetFirst(),
+                                is_signed)};
+    break;
+  }
+
+  // #RULE Token::FloatType is one of the types Float32 or Float64
+  case Token::FloatType: {
+    // #NOTE: the lexer only matches "Float"(32|64)
+    auto maybe_width = ToNumber<unsigned>(text.substr(5));
+    assert(maybe_width);
+    nexttok(); // Eat "Float"(32|64)
+    return {env.GetFloatType(annotations, maybe_width.GetFirst())};
+    break;
+  }
+
   // #RULE Token::BooleanType is the type Bool
   case Token::BooleanType: {
     nexttok(); // Eat "Bool"
@@ -986,6 +1358,11 @@ auto Parser::ParseType(CompilationUnit &env) -> Parser::TypeResult {
     return ParseArrayType(env);
   }
 
+  // #RULE Token::VectorType predicts the type Vector
+  case Token::VectorType: {
+    return ParseVectorType(env);
+  }
+
   // #RULE Token::Star predicts the type of a pointer
   case Token::Star: {
     return ParsePointerType(env);
@@ -1057,6 +1434,50 @@ auto Parser::ParseArrayType(CompilationUnit &env) -> TypeResult {
   return {env.GetArrayType(annotations, maybe_integer.GetFirst(), array_type)};
 }
 
+auto Parser::ParseVectorType(CompilationUnit &env) -> TypeResult {
+  Location lhs_loc = location;
+  nexttok(); // eat 'Vector'
+
+  if (!Expect(Token::LessThan)) {
+    return {Error(Error::Code::MissingLessThan, location, text)};
+  }
+
+  TRY(element_type_result, element_type, ParseType, env)
+
+  if (!Expect(Token::Semicolon)) {
+    return {Error(Error::Code::MissingArraySemicolon, location, text)};
+  }
+
+  if (!Peek(Token::Integer)) {
+    return {Error(Error::Code::MissingArrayNum, location, text)};
+  }
+
+  auto maybe_integer = ToNumber<Integer::Value>(text);
+  if (!maybe_integer) {
+    return Error{maybe_integer.GetSecond(), location, text};
+  }
+  auto length = maybe_integer.GetFirst();
+
+  nexttok(); // eat [0-9]+
+
+  if (!Expect(Token::GreaterThan)) {
+    return {Error(Error::Code::MissingGreaterThan, location, text)};
+  }
+
+  // #RULE a vector has at least one lane, and each lane is a scalar
+  if ((length == 0) || !VectorType::IsElementType(element_type)) {
+    Location vector_loc(lhs_loc.firstLine,
+                        lhs_loc.firstColumn,
+                        location.lastLine,
+                        location.lastColumn);
+    return {Error(Error::Code::BadVectorType, vector_loc, text)};
+  }
+
+  Type::Annotations annotations;
+  annotations.IsInMemory(true);
+  return {env.GetVectorType(annotations, length, element_type)};
+}
+
 auto Parser::ParsePointerType(CompilationUnit &env) -> TypeResult {
   nexttok(); // eat "*"
   // #RULE pointer types must refer to an in memory type
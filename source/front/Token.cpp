@@ -78,10 +78,19 @@ auto ToString(const Token token) -> std::string_view {
   case Token::GreaterThanOrEqual: {
     return ">=";
   }
+  case Token::ShiftLeft: {
+    return "<<";
+  }
+  case Token::ShiftRight: {
+    return ">>";
+  }
 
   case Token::Dot: {
     return ".";
   }
+  case Token::DotDot: {
+    return "..";
+  }
   case Token::Comma: {
     return ",";
   }
@@ -131,6 +140,15 @@ auto ToString(const Token token) -> std::string_view {
   case Token::IntegerType: {
     return "Integer";
   }
+  case Token::SizedIntegerType: {
+    return "Token::SizedIntegerType";
+  }
+  case Token::Float: {
+    return "Token::Float";
+  }
+  case Token::FloatType: {
+    return "Token::FloatType";
+  }
   case Token::True: {
     return "true";
   }
@@ -140,6 +158,9 @@ auto ToString(const Token token) -> std::string_view {
   case Token::BooleanType: {
     return "Boolean";
   }
+  case Token::VectorType: {
+    return "Vector";
+  }
 
   case Token::Fn: {
     return "fn";
@@ -162,6 +183,16 @@ auto ToString(const Token token) -> std::string_view {
   case Token::Do: {
     return "do";
   }
+  case Token::For: {
+    return "for";
+  }
+  case Token::In: {
+    return "in";
+  }
+
+  case Token::Intrinsic: {
+    return "Token::Intrinsic";
+  }
   default: {
     FatalError("Unknown Token Kind");
     return {"Unknown"};
@@ -43,6 +43,43 @@ auto BinopIntMod(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
   return env.CreateSRem(left, right, "imod");
 }
 
+auto BinopIntUDiv(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateUDiv(left, right, "udiv");
+}
+
+auto BinopIntUMod(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateURem(left, right, "umod");
+}
+
+auto BinopIntAnd(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateAnd(left, right, "iand");
+}
+
+auto BinopIntOr(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateOr(left, right, "ior");
+}
+
+// #NOTE: shifting by the width of the type or more is poison,
+// just as it is undefined behavior in C.
+auto BinopIntShl(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateShl(left, right, "shl");
+}
+
+auto BinopIntAShr(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateAShr(left, right, "ashr");
+}
+
+auto BinopIntLShr(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateLShr(left, right, "lshr");
+}
+
 auto BinopIntEq(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
     -> llvm::Value * {
   return env.CreateICmpEQ(left, right, "ieq");
@@ -83,6 +120,26 @@ auto BinopIntLe(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
   return env.CreateICmpSLE(left, right, "ile");
 }
 
+auto BinopIntUGt(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateICmpUGT(left, right, "ugt");
+}
+
+auto BinopIntUGe(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateICmpUGE(left, right, "uge");
+}
+
+auto BinopIntULt(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateICmpULT(left, right, "ult");
+}
+
+auto BinopIntULe(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateICmpULE(left, right, "ule");
+}
+
 auto BinopBoolAnd(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
     -> llvm::Value * {
   return env.CreateAnd(left, right, "and");
@@ -93,6 +150,151 @@ auto BinopBoolOr(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
   return env.CreateOr(left, right, "or");
 }
 
+auto BinopFloatAdd(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFAdd(left, right, "fadd");
+}
+
+auto BinopFloatSub(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFSub(left, right, "fsub");
+}
+
+auto BinopFloatMul(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFMul(left, right, "fmul");
+}
+
+auto BinopFloatDiv(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFDiv(left, right, "fdiv");
+}
+
+auto BinopFloatMod(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFRem(left, right, "fmod");
+}
+
+// #NOTE: the ordered comparisons are false when either side is
+// a NaN, so only != holds for a NaN, as in C.
+auto BinopFloatEq(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFCmpOEQ(left, right, "feq");
+}
+
+auto BinopFloatNe(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFCmpUNE(left, right, "fne");
+}
+
+auto BinopFloatGt(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFCmpOGT(left, right, "fgt");
+}
+
+auto BinopFloatGe(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFCmpOGE(left, right, "fge");
+}
+
+auto BinopFloatLt(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFCmpOLT(left, right, "flt");
+}
+
+auto BinopFloatLe(llvm::Value *left, llvm::Value *right, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFCmpOLE(left, right, "fle");
+}
+
+namespace {
+// #RULE every integer type has the same binops, the signedness
+// of the type selects the division, remainder, ordering and
+// right shift instructions. comparisons result in bool_ty.
+void RegisterIntegerBinops(CompilationUnit &env,
+                           Type::Pointer    int_ty,
+                           Type::Pointer    bool_ty,
+                           bool             is_signed) {
+  env.RegisterBinop(Token::Equals, int_ty, int_ty, bool_ty, BinopIntEq);
+  env.RegisterBinop(Token::NotEquals, int_ty, int_ty, bool_ty, BinopIntNe);
+  env.RegisterBinop(Token::LessThan,
+                    int_ty,
+                    int_ty,
+                    bool_ty,
+                    is_signed ? BinopIntLt : BinopIntULt);
+  env.RegisterBinop(Token::LessThanOrEqual,
+                    int_ty,
+                    int_ty,
+                    bool_ty,
+                    is_signed ? BinopIntLe : BinopIntULe);
+  env.RegisterBinop(Token::GreaterThan,
+                    int_ty,
+                    int_ty,
+                    bool_ty,
+                    is_signed ? BinopIntGt : BinopIntUGt);
+  env.RegisterBinop(Token::GreaterThanOrEqual,
+                    int_ty,
+                    int_ty,
+                    bool_ty,
+                    is_signed ? BinopIntGe : BinopIntUGe);
+  env.RegisterBinop(Token::And, int_ty, int_ty, int_ty, BinopIntAnd);
+  env.RegisterBinop(Token::Or, int_ty, int_ty, int_ty, BinopIntOr);
+  env.RegisterBinop(Token::Add, int_ty, int_ty, int_ty, BinopIntAdd);
+  env.RegisterBinop(Token::Sub, int_ty, int_ty, int_ty, BinopIntSub);
+  env.RegisterBinop(Token::Star, int_ty, int_ty, int_ty, BinopIntMul);
+  env.RegisterBinop(Token::Divide,
+                    int_ty,
+                    int_ty,
+                    int_ty,
+                    is_signed ? BinopIntSDiv : BinopIntUDiv);
+  env.RegisterBinop(Token::Modulo,
+                    int_ty,
+                    int_ty,
+                    int_ty,
+                    is_signed ? BinopIntMod : BinopIntUMod);
+  env.RegisterBinop(Token::ShiftLeft, int_ty, int_ty, int_ty, BinopIntShl);
+  env.RegisterBinop(Token::ShiftRight,
+                    int_ty,
+                    int_ty,
+                    int_ty,
+                    is_signed ? BinopIntAShr : BinopIntLShr);
+}
+
+// #RULE every float type has the arithmetic and comparison
+// binops, comparisons result in bool_ty.
+void RegisterFloatBinops(CompilationUnit &env,
+                         Type::Pointer    float_ty,
+                         Type::Pointer    bool_ty) {
+  env.RegisterBinop(Token::Equals, float_ty, float_ty, bool_ty, BinopFloatEq);
+  env.RegisterBinop(Token::NotEquals,
+                    float_ty,
+                    float_ty,
+                    bool_ty,
+                    BinopFloatNe);
+  env.RegisterBinop(Token::LessThan, float_ty, float_ty, bool_ty, BinopFloatLt);
+  env.RegisterBinop(Token::LessThanOrEqual,
+                    float_ty,
+                    float_ty,
+                    bool_ty,
+                    BinopFloatLe);
+  env.RegisterBinop(Token::GreaterThan,
+                    float_ty,
+                    float_ty,
+                    bool_ty,
+                    BinopFloatGt);
+  env.RegisterBinop(Token::GreaterThanOrEqual,
+                    float_ty,
+                    float_ty,
+                    bool_ty,
+                    BinopFloatGe);
+  env.RegisterBinop(Token::Add, float_ty, float_ty, float_ty, BinopFloatAdd);
+  env.RegisterBinop(Token::Sub, float_ty, float_ty, float_ty, BinopFloatSub);
+  env.RegisterBinop(Token::Star, float_ty, float_ty, float_ty, BinopFloatMul);
+  env.RegisterBinop(Token::Divide, float_ty, float_ty, float_ty, BinopFloatDiv);
+  env.RegisterBinop(Token::Modulo, float_ty, float_ty, float_ty, BinopFloatMod);
+}
+} // namespace
+
 void InitializeBinopPrimitives(CompilationUnit &env) {
   // #RULE we use the looser version of equality within
   // the UnopTable which does not check that annotations match.
@@ -104,28 +306,56 @@ void InitializeBinopPrimitives(CompilationUnit &env) {
   Type::Pointer int_ty  = env.GetIntType(annotations);
   Type::Pointer bool_ty = env.GetBoolType(annotations);
 
-  env.RegisterBinop(Token::Equals, int_ty, int_ty, bool_ty, BinopIntEq);
   env.RegisterBinop(Token::Equals, bool_ty, bool_ty, bool_ty, BinopBoolEq);
-  env.RegisterBinop(Token::NotEquals, int_ty, int_ty, bool_ty, BinopIntNe);
   env.RegisterBinop(Token::NotEquals, bool_ty, bool_ty, bool_ty, BinopBoolNe);
-  env.RegisterBinop(Token::LessThan, int_ty, int_ty, bool_ty, BinopIntLt);
-  env.RegisterBinop(Token::LessThanOrEqual,
-                    int_ty,
-                    int_ty,
-                    bool_ty,
-                    BinopIntLe);
-  env.RegisterBinop(Token::GreaterThan, int_ty, int_ty, bool_ty, BinopIntGt);
-  env.RegisterBinop(Token::GreaterThanOrEqual,
-                    int_ty,
-                    int_ty,
-                    bool_ty,
-                    BinopIntGe);
   env.RegisterBinop(Token::And, bool_ty, bool_ty, bool_ty, BinopBoolAnd);
   env.RegisterBinop(Token::Or, bool_ty, bool_ty, bool_ty, BinopBoolOr);
-  env.RegisterBinop(Token::Add, int_ty, int_ty, int_ty, BinopIntAdd);
-  env.RegisterBinop(Token::Sub, int_ty, int_ty, int_ty, BinopIntSub);
-  env.RegisterBinop(Token::Star, int_ty, int_ty, int_ty, BinopIntMul);
-  env.RegisterBinop(Token::Divide, int_ty, int_ty, int_ty, BinopIntSDiv);
-  env.RegisterBinop(Token::Modulo, int_ty, int_ty, int_ty, BinopIntMod);
+  RegisterIntegerBinops(env, int_ty, bool_ty, /* is_signed */ true);
+
+  for (unsigned bit_width : {8U, 16U, 32U, 64U}) {
+    for (bool is_signed : {true, false}) {
+      Type::Pointer sized_ty =
+          env.GetSizedIntType(annotations, bit_width, is_signed);
+      RegisterIntegerBinops(env, sized_ty, bool_ty, is_signed);
+    }
+  }
+
+  for (unsigned bit_width : {32U, 64U}) {
+    RegisterFloatBinops(env, env.GetFloatType(annotations, bit_width), bool_ty);
+  }
+}
+
+void InitializeVectorBinopPrimitives(CompilationUnit  &env,
+                                     const VectorType *vector_type) {
+  // #RULE the binops of a vector are the binops of it's lanes
+  // applied to each lane, comparisons result in a vector of Booleans.
+  // the scalar implementations are reused, as the instructions
+  // they emit apply lane wise when given vectors.
+  Type::Annotations annotations;
+  annotations.IsInMemory(true);
+  Type::Pointer vec_ty  = vector_type;
+  Type::Pointer mask_ty = env.GetVectorType(annotations,
+                                            vector_type->GetLength(),
+                                            env.GetBoolType(annotations));
+
+  if (llvm::isa<BooleanType>(vector_type->GetElementType())) {
+    env.RegisterBinop(Token::Equals, vec_ty, vec_ty, mask_ty, BinopBoolEq);
+    env.RegisterBinop(Token::NotEquals, vec_ty, vec_ty, mask_ty, BinopBoolNe);
+    env.RegisterBinop(Token::And, vec_ty, vec_ty, vec_ty, BinopBoolAnd);
+    env.RegisterBinop(Token::Or, vec_ty, vec_ty, vec_ty, BinopBoolOr);
+    return;
+  }
+
+  if (llvm::isa<FloatType>(vector_type->GetElementType())) {
+    RegisterFloatBinops(env, vec_ty, mask_ty);
+    return;
+  }
+
+  const auto *sized_type =
+      llvm::dyn_cast<SizedIntegerType>(vector_type->GetElementType());
+  RegisterIntegerBinops(env,
+                        vec_ty,
+                        mask_ty,
+                        (sized_type == nullptr) || sized_type->IsSigned());
 }
 } // namespace pink
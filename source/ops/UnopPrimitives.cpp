@@ -22,6 +22,11 @@ auto UnopIntNegate(llvm::Value *term, CompilationUnit &env) -> llvm::Value * {
   return env.CreateNeg(term);
 }
 
+auto UnopFloatNegate(llvm::Value *term, CompilationUnit &env)
+    -> llvm::Value * {
+  return env.CreateFNeg(term);
+}
+
 auto UnopBoolNegate(llvm::Value *term, CompilationUnit &env) -> llvm::Value * {
   return env.CreateNot(term);
 }
@@ -39,5 +44,36 @@ void InitializeUnopPrimitives(CompilationUnit &env) {
 
   env.RegisterUnop(Token::Sub, integer_type, integer_type, UnopIntNegate);
   env.RegisterUnop(Token::Not, boolean_type, boolean_type, UnopBoolNegate);
+
+  // #NOTE: negating an unsigned integer wraps, as in C
+  for (unsigned bit_width : {8U, 16U, 32U, 64U}) {
+    for (bool is_signed : {true, false}) {
+      Type::Pointer sized_type =
+          env.GetSizedIntType(annotations, bit_width, is_signed);
+      env.RegisterUnop(Token::Sub, sized_type, sized_type, UnopIntNegate);
+    }
+  }
+
+  for (unsigned bit_width : {32U, 64U}) {
+    Type::Pointer float_type = env.GetFloatType(annotations, bit_width);
+    env.RegisterUnop(Token::Sub, float_type, float_type, UnopFloatNegate);
+  }
+}
+
+void InitializeVectorUnopPrimitives(CompilationUnit  &env,
+                                    const VectorType *vector_type) {
+  // #RULE the unops of a vector are the unops of it's lanes
+  // applied to each lane.
+  if (llvm::isa<BooleanType>(vector_type->GetElementType())) {
+    env.RegisterUnop(Token::Not, vector_type, vector_type, UnopBoolNegate);
+    return;
+  }
+
+  if (llvm::isa<FloatType>(vector_type->GetElementType())) {
+    env.RegisterUnop(Token::Sub, vector_type, vector_type, UnopFloatNegate);
+    return;
+  }
+
+  env.RegisterUnop(Token::Sub, vector_type, vector_type, UnopIntNegate);
 }
 } // namespace pink
\ No newline at end of file
@@ -30,7 +30,20 @@ auto FunctionType::ToLLVM(CompilationUnit &unit) const noexcept
   std::vector<llvm::Type *> llvm_argument_types{};
   llvm_argument_types.reserve(arguments_size);
 
+  // #RULE integers narrower than 32 bits are extended to a full
+  // register according to their signedness, as the C ABI requires.
+  auto extension_attributes = [&unit](Type::Pointer type) {
+    auto builder = unit.GetAttributeBuilder();
+    if (const auto *sized_type = llvm::dyn_cast<SizedIntegerType>(type);
+        (sized_type != nullptr) && (sized_type->GetBitWidth() < 32)) {
+      builder.addAttribute(sized_type->IsSigned() ? llvm::Attribute::SExt
+                                                  : llvm::Attribute::ZExt);
+    }
+    return unit.GetAttributeSet(builder);
+  };
+
   auto *llvm_return_type = return_type->ToLLVM(unit);
+  return_attributes      = extension_attributes(return_type);
   // #RULE if the return type of a function will not fit into a single
   // register we must pass it as a hidden parameter, we place it first in
   // the argument list. This parameter must be a pointer type, with the
@@ -52,7 +65,7 @@ auto FunctionType::ToLLVM(CompilationUnit &unit) const noexcept
 
     if (llvm_argument_type->isSingleValueType()) {
       llvm_argument_types.emplace_back(llvm_argument_type);
-      arguments_attributes.emplace_back(unit.GetAttributeSet());
+      arguments_attributes.emplace_back(extension_attributes(argument));
     } else {
       auto argument_attributes_builder = unit.GetAttributeBuilder();
       argument_attributes_builder.addByValAttr(llvm_argument_type);
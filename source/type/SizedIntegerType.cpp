@@ -0,0 +1,28 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+#include "type/SizedIntType.h"
+
+#include "aux/Environment.h"
+
+namespace pink {
+auto SizedIntegerType::ToLLVM(CompilationUnit &unit) const noexcept
+    -> llvm::Type * {
+  auto *llvm_integer_type = unit.LLVMSizedIntegerType(bit_width);
+  SetCachedLLVMType(llvm_integer_type);
+  return llvm_integer_type;
+}
+} // namespace pink
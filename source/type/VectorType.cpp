@@ -0,0 +1,59 @@
+// Copyright (C) 2023 cadence
+//
+// This file is part of pink.
+//
+// pink is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// pink is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with pink.  If not, see <http://www.gnu.org/licenses/>.
+#include "type/VectorType.h"
+#include "type/BoolType.h"
+#include "type/FloatType.h"
+#include "type/IntType.h"
+#include "type/SizedIntType.h"
+
+#include "aux/Environment.h"
+
+namespace pink {
+auto VectorType::IsElementType(Type::Pointer type) noexcept -> bool {
+  // #RULE only scalars may be the lanes of a vector
+  return llvm::isa<IntegerType>(type) || llvm::isa<SizedIntegerType>(type) ||
+         llvm::isa<FloatType>(type) || llvm::isa<BooleanType>(type);
+}
+
+auto VectorType::ToLLVM(CompilationUnit &unit) const noexcept -> llvm::Type * {
+  auto *llvm_element_type = element_type->ToLLVM(unit);
+  auto *llvm_vector_type  = unit.LLVMVectorType(llvm_element_type, length);
+  SetCachedLLVMType(llvm_vector_type);
+  return llvm_vector_type;
+}
+
+auto VectorType::Equals(Type::Pointer right) const noexcept -> bool {
+  const auto *other = llvm::dyn_cast<const VectorType>(right);
+  if (other == nullptr) {
+    return false;
+  }
+
+  if (length != other->length) {
+    return false;
+  }
+
+  return element_type->Equals(other->element_type);
+}
+
+void VectorType::Print(std::ostream &stream) const noexcept {
+  stream << "Vector<";
+  element_type->Print(stream);
+  stream << "; ";
+  stream << std::to_string(length);
+  stream << ">";
+}
+} // namespace pink
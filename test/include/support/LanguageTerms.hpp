@@ -188,3 +188,7 @@ constexpr inline auto term_aev =
 constexpr inline auto term_aew = "fn aew(a: fn() -> Integer) { a(); }";
 constexpr inline auto term_aex = "fn aex(a: fn(Integer, Integer) -> Integer, "
                                  "b: Integer, c: Integer) { a(b, c); }";
+
+constexpr inline auto term_aey = "fn aey(x: Integer) { [1, x]; }";
+constexpr inline auto term_aez = "fn aez() { [1, -2]; }";
+constexpr inline auto term_afa = "fn afa() { [1, true]; }";
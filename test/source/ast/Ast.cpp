@@ -97,6 +97,18 @@ TEST_CASE("ast/Array", "[unit][ast]") {
   for (const auto &element : array->GetElements()) {
     REQUIRE(element == nullptr);
   }
+  REQUIRE(!array->IsPacked());
+  REQUIRE(array->Size() == 3);
+
+  pink::Array::Packed packed{0, 1, 2, 3};
+  pink::Ast::Pointer  packed_ast =
+      std::make_unique<pink::Array>(location, packed);
+  auto *packed_array = llvm::dyn_cast<pink::Array>(packed_ast.get());
+  REQUIRE(packed_array != nullptr);
+  REQUIRE(packed_array->IsPacked());
+  REQUIRE(packed_array->Size() == packed.size());
+  REQUIRE(packed_array->GetElements().empty());
+  REQUIRE(packed_array->GetPacked() == packed);
 }
 
 TEST_CASE("ast/Assignment", "[unit][ast]") {
@@ -200,6 +212,20 @@ TEST_CASE("ast/IfThenElse", "[unit][ast]") {
   REQUIRE(conditional->GetSecond() == nullptr);
 }
 
+TEST_CASE("ast/Cast", "[unit][ast]") {
+  pink::Location     location = RandomLocation();
+  pink::Ast::Pointer right;
+  pink::Ast::Pointer ast =
+      std::make_unique<pink::Cast>(location, nullptr, std::move(right));
+  REQUIRE(ast->GetKind() == pink::Ast::Kind::Cast);
+  REQUIRE(ast->GetLocation() == location);
+  REQUIRE(llvm::isa<pink::Cast>(ast));
+  auto *cast = llvm::dyn_cast<pink::Cast>(ast.get());
+  REQUIRE(cast != nullptr);
+  REQUIRE(cast->GetTarget() == nullptr);
+  REQUIRE(cast->GetRight() == nullptr);
+}
+
 TEST_CASE("ast/Dot", "[unit][ast]") {
   pink::Location     location = RandomLocation();
   pink::Ast::Pointer left;
@@ -215,6 +241,18 @@ TEST_CASE("ast/Dot", "[unit][ast]") {
   REQUIRE(dot->GetRight() == nullptr);
 }
 
+TEST_CASE("ast/Float", "[unit][ast]") {
+  const pink::Float::Value value    = 4.25;
+  pink::Location           location = RandomLocation();
+  pink::Ast::Pointer       ast = std::make_unique<pink::Float>(location, value);
+  REQUIRE(ast->GetKind() == pink::Ast::Kind::Float);
+  REQUIRE(ast->GetLocation() == location);
+  REQUIRE(llvm::isa<pink::Float>(ast));
+  auto *literal = llvm::dyn_cast<pink::Float>(ast.get());
+  REQUIRE(literal != nullptr);
+  REQUIRE(literal->GetValue() == value);
+}
+
 TEST_CASE("ast/Function", "[unit][ast]") {
   pink::Location            location = RandomLocation();
   pink::InternedString      name     = "f";
@@ -253,6 +291,31 @@ TEST_CASE("ast/Integer", "[unit][ast]") {
   REQUIRE(integer->GetValue() == value);
 }
 
+TEST_CASE("ast/Intrinsic", "[unit][ast]") {
+  pink::Location             location = RandomLocation();
+  pink::Intrinsic::Arguments arguments;
+  arguments.emplace_back(nullptr);
+  pink::Ast::Pointer ast =
+      std::make_unique<pink::Intrinsic>(location,
+                                        pink::Intrinsic::Op::PoolAlloc,
+                                        nullptr,
+                                        std::move(arguments));
+  REQUIRE(ast->GetKind() == pink::Ast::Kind::Intrinsic);
+  REQUIRE(ast->GetLocation() == location);
+  REQUIRE(llvm::isa<pink::Intrinsic>(ast));
+  auto *intrinsic = llvm::dyn_cast<pink::Intrinsic>(ast.get());
+  REQUIRE(intrinsic != nullptr);
+  REQUIRE(intrinsic->GetOp() == pink::Intrinsic::Op::PoolAlloc);
+  REQUIRE(intrinsic->GetTypeArgument() == nullptr);
+  REQUIRE(intrinsic->GetArguments().size() == 1);
+  REQUIRE(pink::Intrinsic::TakesType(intrinsic->GetOp()));
+  REQUIRE(pink::Intrinsic::Lookup("arena_reset") ==
+          pink::Intrinsic::Op::ArenaReset);
+  REQUIRE(pink::Intrinsic::Lookup("mem_copy") == pink::Intrinsic::Op::MemCopy);
+  REQUIRE(!pink::Intrinsic::TakesType(pink::Intrinsic::Op::MemFill));
+  REQUIRE(!pink::Intrinsic::Lookup("arena").has_value());
+}
+
 TEST_CASE("ast/Nil", "[unit][ast]") {
   pink::Location     location = RandomLocation();
   pink::Ast::Pointer ast      = std::make_unique<pink::Nil>(location);
@@ -295,6 +358,31 @@ TEST_CASE("ast/Tuple", "[unit][ast]") {
   }
 }
 
+TEST_CASE("ast/For", "[unit][ast]") {
+  pink::Location       location = RandomLocation();
+  pink::InternedString symbol   = "i";
+  pink::Ast::Pointer   first;
+  pink::Ast::Pointer   last;
+  pink::Ast::Pointer   body;
+  pink::Ast::Pointer   ast = std::make_unique<pink::For>(location,
+                                                       symbol,
+                                                       std::move(first),
+                                                       std::move(last),
+                                                       std::move(body),
+                                                       pink::For::Hints{4, 8});
+  REQUIRE(ast->GetKind() == pink::Ast::Kind::For);
+  REQUIRE(ast->GetLocation() == location);
+  REQUIRE(llvm::isa<pink::For>(ast));
+  auto *loop = llvm::dyn_cast<pink::For>(ast.get());
+  REQUIRE(loop != nullptr);
+  REQUIRE(loop->GetSymbol() == symbol);
+  REQUIRE(loop->GetFirst() == nullptr);
+  REQUIRE(!loop->IsRange());
+  REQUIRE(loop->GetBody() == nullptr);
+  REQUIRE(loop->GetHints().unroll == 4);
+  REQUIRE(loop->GetHints().vectorize == 8);
+}
+
 TEST_CASE("ast/Unop", "[unit][ast]") {
   pink::Location     location = RandomLocation();
   pink::Token        op       = pink::Token::Not;
@@ -322,6 +410,25 @@ TEST_CASE("ast/Variable", "[unit][ast]") {
   REQUIRE(variable->GetSymbol() == symbol);
 }
 
+TEST_CASE("ast/Vector", "[unit][ast]") {
+  pink::Location          location = RandomLocation();
+  pink::Vector::Arguments arguments;
+  arguments.emplace_back(nullptr);
+  arguments.emplace_back(nullptr);
+  pink::Ast::Pointer ast =
+      std::make_unique<pink::Vector>(location, nullptr, std::move(arguments));
+  REQUIRE(ast->GetKind() == pink::Ast::Kind::Vector);
+  REQUIRE(ast->GetLocation() == location);
+  REQUIRE(llvm::isa<pink::Vector>(ast));
+  auto *vector = llvm::dyn_cast<pink::Vector>(ast.get());
+  REQUIRE(vector != nullptr);
+  REQUIRE(vector->GetVectorType() == nullptr);
+  REQUIRE(vector->GetArguments().size() == 2);
+  for (const auto &argument : *vector) {
+    REQUIRE(argument == nullptr);
+  }
+}
+
 TEST_CASE("ast/While", "[unit][ast]") {
   pink::Location     location = RandomLocation();
   pink::Ast::Pointer test;
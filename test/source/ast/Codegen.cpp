@@ -116,7 +116,9 @@ static auto Execute(char const *program, char *const *argv) -> int {
   return result;
 }
 
-static auto CompileAndRunProgram(const std::string &contents)
+static auto
+CompileAndRunProgram(const std::string               &contents,
+                     const std::vector<char const *> &options = {})
     -> std::optional<int> {
   auto temp_program = CreateUniqueTempFilename();
 
@@ -126,8 +128,9 @@ static auto CompileAndRunProgram(const std::string &contents)
   EmitTempFile(contents, temp_file);
 
   std::vector<char const *> compile;
-  compile.reserve(3);
+  compile.reserve(3 + options.size());
   compile.emplace_back("./pink");
+  compile.insert(compile.end(), options.begin(), options.end());
   compile.emplace_back(temp_file.c_str());
   compile.emplace_back(nullptr);
 
@@ -162,6 +165,31 @@ static auto CompileAndRunProgram(const std::string &contents)
   return result;
 }
 
+static auto JITRunProgram(const std::string &contents) -> int {
+  auto temp_file = CreateUniqueTempFilename();
+  temp_file.replace_extension(".p");
+
+  EmitTempFile(contents, temp_file);
+
+  std::vector<char const *> run;
+  run.reserve(4);
+  run.emplace_back("./pink");
+  run.emplace_back("--run");
+  run.emplace_back(temp_file.c_str());
+  run.emplace_back(nullptr);
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto result = Execute(run[0], const_cast<char *const *>(run.data()));
+
+  std::error_code errc;
+  fs::remove(temp_file, errc);
+  if (errc) {
+    pink::FatalError(errc);
+  }
+
+  return result;
+}
+
 // NOLINTBEGIN
 TEST_CASE("ast/Codegen: Integer", "[integration][ast][ast/action]") {
   std::random_device            seed;
@@ -775,6 +803,23 @@ TEST_CASE("ast/Codegen: Array Subscript Assignment",
   CHECK(result.value() == value);
 }
 
+TEST_CASE("ast/Codegen: Array Mixed Literal Elements",
+          "[integration][ast][ast/action]") {
+  // integer literals followed by a non literal element must
+  // all be kept, in order.
+  std::string main = "fn main() {\n"
+                     " x := 4;\n"
+                     " a := [1, x];\n"
+                     " b := [1, 2, -3];\n"
+                     " a[0] * 10 + a[1] + b[1] * 20 - b[2];\n"
+                     "}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == 57);
+}
+
 TEST_CASE("ast/Codegen: Array Subscript Binop",
           "[integration][ast][ast/action]") {
   std::random_device                         seed;
@@ -806,4 +851,455 @@ TEST_CASE("ast/Codegen: Array Subscript Binop",
   CHECK(result.value() == (elements[element] + value));
 }
 
-// NOLINTEND
\ No newline at end of file
+TEST_CASE("ast/Codegen: Array Subscript Out Of Bounds",
+          "[integration][ast][ast/action]") {
+  std::random_device            seed;
+  std::mt19937                  gen{seed()};
+  std::uniform_int_distribution dist{6, 100};
+  auto                          index = dist(gen);
+
+  std::string main  = "fn main() { a := [0, 1, 2, 3, 4, 5];\n i := ";
+  main             += std::to_string(index);
+  main             += ";\n a[i] + 2;\n}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  // #NOTE: a runtime error exits with 1
+  CHECK(result.value() == 1);
+}
+
+TEST_CASE("ast/Codegen: Array Assignment", "[integration][ast][ast/action]") {
+  std::random_device                         seed;
+  std::mt19937                               gen{seed()};
+  std::uniform_int_distribution              dist{0, 100};
+  std::uniform_int_distribution<std::size_t> access_range{0, 7};
+  std::array elements = {dist(gen),
+                         dist(gen),
+                         dist(gen),
+                         dist(gen),
+                         dist(gen),
+                         dist(gen),
+                         dist(gen),
+                         dist(gen)};
+  auto       element  = access_range(gen);
+
+  std::string main = "fn main() { a := [";
+  for (std::size_t index = 0; index < elements.size(); ++index) {
+    main += std::to_string(elements[index]);
+
+    if (index < (elements.size() - 1)) {
+      main += ", ";
+    }
+  }
+  main += "];\n b := [0, 0, 0, 0, 0, 0, 0, 0];\n b = a;\n b[";
+  main += std::to_string(element);
+  main += "];\n}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == elements[element]);
+}
+
+TEST_CASE("ast/Codegen: Global Array Assignment",
+          "[integration][ast][ast/action]") {
+  // the global is copied from it's address, as it is not
+  // a constant aggregate.
+  std::string main = "g := [1, 2, 3, 4, 5, 6, 7, 8];\n"
+                     "fn main() {\n"
+                     " b := [0, 0, 0, 0, 0, 0, 0, 0];\n"
+                     " b = g;\n"
+                     " b[2] + b[7];\n"
+                     "}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == 11);
+}
+
+TEST_CASE("ast/Codegen: While Loop", "[integration][ast][ast/action]") {
+  std::random_device            seed;
+  std::mt19937                  gen{seed()};
+  std::uniform_int_distribution dist{0, 20};
+  auto                          count = dist(gen);
+
+  std::string main  = "fn main() { i := 0;\n sum := 0;\n while i < ";
+  main             += std::to_string(count);
+  main             += " do {\n sum = sum + i;\n i = i + 1;\n }\n sum;\n}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == (count * (count - 1)) / 2);
+}
+
+TEST_CASE("ast/Codegen: For Range Loop", "[integration][ast][ast/action]") {
+  std::random_device            seed;
+  std::mt19937                  gen{seed()};
+  std::uniform_int_distribution dist{0, 20};
+  auto                          count = dist(gen);
+
+  std::string main  = "fn main() { sum := 0;\n for i in 0 .. ";
+  main             += std::to_string(count);
+  main             += " unroll 2 do {\n sum = sum + i;\n }\n sum;\n}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == (count * (count - 1)) / 2);
+}
+
+TEST_CASE("ast/Codegen: For Loop Shadowing",
+          "[integration][ast][ast/action]") {
+  // the loop variable shadows i, which must keep it's value
+  // once the loop is exited.
+  std::string main = "fn main() {\n"
+                     " i := 5;\n"
+                     " for i in 0 .. 3 do {\n i;\n }\n"
+                     " i;\n"
+                     "}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == 5);
+}
+
+TEST_CASE("ast/Codegen: For Loop Scope", "[integration][ast][ast/action]") {
+  // the loop variable and the bindings of the body leave
+  // with the loop, while sum is carried around it.
+  std::string main = "fn main() {\n"
+                     " sum := 0;\n"
+                     " for i in 0 .. 4 do {\n"
+                     "  j := i + i;\n"
+                     "  sum = sum + j;\n"
+                     " }\n"
+                     " sum;\n"
+                     "}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == 12);
+}
+
+TEST_CASE("ast/Codegen: For Sibling Loops",
+          "[integration][ast][ast/action]") {
+  // each loop binds it's own i.
+  std::string main = "fn main() {\n"
+                     " sum := 0;\n"
+                     " for i in 0 .. 3 do {\n sum = sum + i;\n }\n"
+                     " for i in 0 .. 4 do {\n sum = sum + i;\n }\n"
+                     " sum;\n"
+                     "}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == 9);
+}
+
+TEST_CASE("ast/Codegen: For Sibling Loops In Memory",
+          "[integration][ast][ast/action]") {
+  // taking the address of the first i keeps both in memory.
+  std::string main = "fn main() {\n"
+                     " sum := 0;\n"
+                     " for i in 0 .. 3 do {\n"
+                     "  p := &i;\n"
+                     "  sum = sum + *p;\n"
+                     " }\n"
+                     " for i in 0 .. 4 do {\n sum = sum + i;\n }\n"
+                     " sum;\n"
+                     "}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == 9);
+}
+
+TEST_CASE("ast/Codegen: For Array Loop", "[integration][ast][ast/action]") {
+  std::random_device            seed;
+  std::mt19937                  gen{seed()};
+  std::uniform_int_distribution dist{0, 25};
+  std::array<int, 8>            elements{};
+  int                           sum = 0;
+  for (auto &element : elements) {
+    element  = dist(gen);
+    sum     += element;
+  }
+
+  std::string main = "fn main() { a := [";
+  for (std::size_t index = 0; index < elements.size(); ++index) {
+    main += std::to_string(elements[index]);
+
+    if (index < (elements.size() - 1)) {
+      main += ", ";
+    }
+  }
+  main += "];\n sum := 0;\n for x in a vectorize 4 do {\n sum = sum + x;\n }";
+  main += "\n sum;\n}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == sum);
+}
+
+TEST_CASE("ast/Codegen: Vector Lanes", "[integration][ast][ast/action]") {
+  std::random_device            seed;
+  std::mt19937                  gen{seed()};
+  std::uniform_int_distribution dist{0, 25};
+  std::array<int, 8>            elements{};
+  for (auto &element : elements) {
+    element = dist(gen);
+  }
+  auto lane = dist(gen);
+
+  std::string main = "fn main() { a := [";
+  for (std::size_t index = 0; index < elements.size(); ++index) {
+    main += std::to_string(elements[index]);
+
+    if (index < (elements.size() - 1)) {
+      main += ", ";
+    }
+  }
+  main += "];\n v := Vector<Integer; 4>(a, 0) + Vector<Integer; 4>(a, 4);";
+  main += "\n v.1 = " + std::to_string(lane) + ";";
+  main += "\n Vector<Integer; 4>(a, 2) = v * Vector<Integer; 4>(2);";
+  main += "\n a[0] + a[2] + a[3] + a[4] + v[2];\n}";
+
+  // a[2..6] = 2 * (a[0..4] + a[4..8]), with lane 1 replaced
+  int sum = elements[0] + (2 * (elements[0] + elements[4])) + (2 * lane) +
+            (3 * (elements[2] + elements[6]));
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == sum);
+}
+
+TEST_CASE("ast/Codegen: Sized Integers", "[integration][ast][ast/action]") {
+  std::string main = "fn main() {\n a := u8(250) + u8(10);";
+  main += "\n b := i8(-128) >> i8(7);";
+  main += "\n c := u8(128) >> u8(7);";
+  main += "\n d := u16(4096) / u16(256);";
+  main += "\n e := 0;";
+  main += "\n if (u8(200) > u8(100)) { e = e + 1; } else { e = e + 0; }";
+  main += "\n if (i8(200) < i8(100)) { e = e + 2; } else { e = e + 0; }";
+  main += "\n Integer(a) + Integer(b) + Integer(c) + Integer(d) + e +";
+  main += " (Integer(u8(255)) - 250);\n}";
+
+  // a wraps to 4, b shifts in the sign bit, c does not,
+  // i8(200) is negative, and u8(255) is zero extended.
+  int expected = 4 + -1 + 1 + 16 + 3 + 5;
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == expected);
+}
+
+TEST_CASE("ast/Codegen: Floats", "[integration][ast][ast/action]") {
+  std::string main = "fn main() {\n a := 1.5 + 2.25;";
+  main += "\n b := Float32(a) * Float32(2.0);";
+  main += "\n t := ((1, 2.5), 3);";
+  main += "\n e := 0;";
+  main += "\n if (a > 3.5) { e = e + 1; } else { e = e + 0; }";
+  main += "\n if (b <= Float32(7.0)) { e = e + 2; } else { e = e + 0; }";
+  main += "\n Integer(b) + e + Integer(t.0.1 * 2.0) +";
+  main += " Integer(Float64(7) / 2.0) + Integer(-a + 10.0) +";
+  main += " Integer(b % Float32(2.0));\n}";
+
+  // a is 3.75, b is 7.5, conversions to Integer round toward zero,
+  // and t.0.1 is the nested tuple access, not the float 0.1
+  int expected = 7 + 1 + 5 + 3 + 6 + 1;
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == expected);
+}
+
+TEST_CASE("ast/Codegen: Heap Allocation", "[integration][ast][ast/action]") {
+  std::string main = "fn main() {\n s := arena_alloc(Integer, 1000);";
+  main += "\n for i in 0 .. 1000 do {\n s[i] = i;\n }";
+  main += "\n sum := 0;\n for x in s do {\n sum = sum + x;\n }";
+  main += "\n arena_reset();\n t := arena_alloc(Integer, 10);";
+  main += "\n p := pool_alloc(Integer, 100);\n p[99] = 7;\n pool_free(p);";
+  main += "\n q := pool_alloc(Integer, 100);";
+  main += "\n r := pool_alloc(Integer, 200000);\n r[199999] = 7;";
+  main += "\n w := r[199999];\n pool_free(r);";
+  main += "\n (sum % 256) + t[3] + q[99] + w;\n}";
+
+  // the arena and the pool both reuse freed memory, which
+  // must read as zero again, and r is too large for any
+  // size class, so it is mapped on it's own.
+  int expected = (499500 % 256) + 0 + 0 + 7;
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == expected);
+}
+
+TEST_CASE("ast/Codegen: Memory Operations", "[integration][ast][ast/action]") {
+  std::string main = "fn main() {\n a := [1, 2, 3, 4, 5, 6, 7, 8];";
+  main += "\n s := arena_alloc(Integer, 8);\n mem_copy(s, a);";
+  main += "\n t := arena_alloc(Integer, 16);\n mem_fill(t, 3);";
+  main += "\n mem_move(t, s);";
+  main += "\n b := [false, false, false];\n mem_fill(b, true);";
+  main += "\n e := 0;";
+  main += "\n if (mem_compare(s, a)) { e = e + 1; } else { e = e + 0; }";
+  main += "\n if (mem_compare(s, t)) { e = e + 0; } else { e = e + 2; }";
+  main += "\n if (b[1]) { e = e + 4; } else { e = e + 0; }";
+  main += "\n sum := 0;\n for x in t do {\n sum = sum + x;\n }";
+  main += "\n sum + e;\n}";
+
+  // t holds 1 through 8 followed by eight 3s, and
+  // slices of differing lengths never compare equal.
+  int expected = 36 + 24 + 1 + 2 + 4;
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == expected);
+}
+
+TEST_CASE("ast/Codegen: Print", "[integration][ast][ast/action]") {
+  // each print is buffered, and the buffer is flushed on exit.
+  std::string main = "fn main() {\n a := [u8(111), u8(107), u8(10)];";
+  main += "\n s := arena_alloc(u8, 2);\n s[0] = u8(104);\n s[1] = u8(10);";
+  main += "\n for i in 0 .. 4 do {\n print(a);\n print(s);\n }";
+  main += "\n 3;\n}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == 3);
+}
+
+TEST_CASE("ast/Codegen: Runtime Names", "[integration][ast][ast/action]") {
+  // a function sharing the name of a runtime function
+  // does not replace the runtime function.
+  std::string main = "fn runtime_arena_alloc(x: Integer) { x + 1; }\n";
+  main += "fn main() {\n s := arena_alloc(Integer, 4);\n s[2] = 5;";
+  main += "\n runtime_arena_alloc(s[2]);\n}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == 6);
+}
+
+TEST_CASE("ast/Codegen: Conditional Assignment",
+          "[integration][ast][ast/action]") {
+  std::random_device            seed;
+  std::mt19937                  gen{seed()};
+  std::uniform_int_distribution dist{0, 100};
+  auto                          a = dist(gen);
+  auto                          b = dist(gen);
+
+  std::string main  = "fn main() { x := 0;\n if (";
+  main             += std::to_string(a);
+  main             += " < ";
+  main             += std::to_string(b);
+  main             += ") { x = 1; } else { x = 2; }\n x;\n}";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == (a < b ? 1 : 2));
+}
+
+TEST_CASE("ast/Codegen: Unreachable Functions",
+          "[integration][ast][ast/action]") {
+  std::random_device            seed;
+  std::mt19937                  gen{seed()};
+  std::uniform_int_distribution dist{2, 100};
+  auto                          value = dist(gen);
+
+  // unused is never called, so it's type error is never seen
+  std::string main  = "fn unused() { true + 1; }\n";
+  main             += "fn used(a: Integer) { a; }\n";
+  main             += "fn main() { used(";
+  main             += std::to_string(value);
+  main             += "); }";
+
+  auto result = CompileAndRunProgram(main);
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == value);
+}
+
+TEST_CASE("ast/Codegen: --profile-generate",
+          "[integration][ast][ast/action]") {
+  auto profile = CreateUniqueTempFilename();
+  profile.replace_extension(".profraw");
+  std::string option{"--profile-generate="};
+  option += profile.string();
+
+  std::string main = "fn main() {\n sum := 0;\n for i in 0 .. 10 do {\n";
+  main += " sum = sum + i;\n }\n sum;\n}";
+
+  auto result = CompileAndRunProgram(main, {option.c_str()});
+
+  REQUIRE(result.has_value());
+  CHECK(result.value() == 45);
+  // the instrumented program writes it's raw profile as it exits
+  CHECK(fs::exists(profile));
+  CHECK(fs::file_size(profile) > 0);
+
+  std::error_code errc;
+  fs::remove(profile, errc);
+}
+
+TEST_CASE("ast/Codegen: --emit-object keeps every function",
+          "[integration][ast][ast/action]") {
+  auto temp_object = CreateUniqueTempFilename();
+  auto temp_file   = temp_object;
+  temp_file.replace_extension(".p");
+  temp_object.replace_extension(".o");
+
+  // an object is not the whole program, so a function
+  // without a caller within the file is still compiled.
+  EmitTempFile("fn library_function(a: Integer) { a + 1; }", temp_file);
+
+  std::vector<char const *> compile;
+  compile.reserve(4);
+  compile.emplace_back("./pink");
+  compile.emplace_back("-c");
+  compile.emplace_back(temp_file.c_str());
+  compile.emplace_back(nullptr);
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto result = Execute(compile[0], const_cast<char *const *>(compile.data()));
+  REQUIRE(result == EXIT_SUCCESS);
+  REQUIRE(fs::exists(temp_object));
+
+  std::ifstream     object{temp_object, std::ios::binary};
+  std::stringstream contents;
+  contents << object.rdbuf();
+  CHECK(contents.str().find("library_function") != std::string::npos);
+
+  std::error_code errc;
+  fs::remove(temp_object, errc);
+  fs::remove(temp_file, errc);
+}
+
+TEST_CASE("ast/Codegen: --run", "[integration][ast][ast/action]") {
+  std::random_device            seed;
+  std::mt19937                  gen{seed()};
+  std::uniform_int_distribution dist{2, 100};
+  auto                          value = dist(gen);
+
+  std::string main  = "fn main() { a := ";
+  main             += std::to_string(value);
+  main             += "; a; }";
+
+  CHECK(JITRunProgram(main) == value);
+}
+
+// NOLINTEND
@@ -894,4 +894,43 @@ TEST_CASE("ast/action/Typecheck::Function", "[unit][ast][ast/action]") {
                              env.GetIntType(annotations),
                              env.GetIntType(annotations)}));
   }
-}
\ No newline at end of file
+  SECTION(term_aey) {
+    auto array = env.GetArrayType(annotations, 2, env.GetIntType(annotations));
+    TYPE_IS(term_aey,
+            env.GetFunctionType(annotations,
+                                array,
+                                {env.GetIntType(annotations)}));
+  }
+  SECTION(term_aez) {
+    auto array = env.GetArrayType(annotations, 2, env.GetIntType(annotations));
+    TYPE_IS(term_aez, env.GetFunctionType(annotations, array, {}));
+  }
+}
+
+TEST_CASE("ast/action/Typecheck::Array mismatched elements",
+          "[unit][ast][ast/action]") {
+  auto              env = pink::CompilationUnit::CreateTestCompilationUnit();
+  std::stringstream stream{term_afa};
+  env.SetIStream(&stream);
+  auto parse_result = env.Parse();
+  REQUIRE(parse_result);
+  auto &expression       = parse_result.GetFirst();
+  auto  typecheck_result = Typecheck(expression, env);
+  // the literal 1 must not be dropped from the array,
+  // so the elements Integer and Boolean cannot unify.
+  REQUIRE(!typecheck_result);
+}
+
+TEST_CASE("ast/action/Typecheck::Function reserved name",
+          "[unit][ast][ast/action]") {
+  auto              env = pink::CompilationUnit::CreateTestCompilationUnit();
+  std::stringstream stream{"fn memcpy() { 0; }"};
+  env.SetIStream(&stream);
+  auto parse_result = env.Parse();
+  REQUIRE(parse_result);
+  auto &expression       = parse_result.GetFirst();
+  auto  typecheck_result = Typecheck(expression, env);
+  // the memory runtime is called by name, so the
+  // name cannot be taken by a function.
+  REQUIRE(!typecheck_result);
+}
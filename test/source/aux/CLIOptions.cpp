@@ -19,7 +19,10 @@
 
 #include "aux/CLIOptions.h"
 
+#include <getopt.h>
+
 #include <sstream>
+#include <vector>
 
 TEST_CASE("aux/CLIFlags", "[unit][aux]") {
   pink::CLIFlags flags;
@@ -30,17 +33,101 @@ TEST_CASE("aux/CLIFlags", "[unit][aux]") {
   REQUIRE(flags.DoEmitAssembly(false) == false);
   REQUIRE(flags.DoEmitAssembly() == false);
 
-  REQUIRE(flags.DoEmitObject() == true);
-  REQUIRE(flags.DoEmitObject(false) == false);
   REQUIRE(flags.DoEmitObject() == false);
   REQUIRE(flags.DoEmitObject(true) == true);
   REQUIRE(flags.DoEmitObject() == true);
+  REQUIRE(flags.DoEmitObject(false) == false);
+  REQUIRE(flags.DoEmitObject() == false);
 
   REQUIRE(flags.DoLink() == true);
   REQUIRE(flags.DoLink(false) == false);
   REQUIRE(flags.DoLink() == false);
   REQUIRE(flags.DoLink(true) == true);
   REQUIRE(flags.DoLink() == true);
+
+  REQUIRE(flags.DoRun() == false);
+  REQUIRE(flags.DoRun(true) == true);
+  REQUIRE(flags.DoRun() == true);
+  REQUIRE(flags.DoRun(false) == false);
+  REQUIRE(flags.DoRun() == false);
+
+  REQUIRE(flags.DoEmitBitcode() == false);
+  REQUIRE(flags.DoEmitBitcode(true) == true);
+  REQUIRE(flags.DoEmitBitcode() == true);
+  REQUIRE(flags.DoEmitBitcode(false) == false);
+  REQUIRE(flags.DoEmitBitcode() == false);
+
+  REQUIRE(flags.DoLinkTimeOptimization() == false);
+  REQUIRE(flags.DoLinkTimeOptimization(true) == true);
+  REQUIRE(flags.DoLinkTimeOptimization() == true);
+  REQUIRE(flags.DoLinkTimeOptimization(false) == false);
+  REQUIRE(flags.DoLinkTimeOptimization() == false);
+
+  REQUIRE(flags.DoBoundsChecks() == true);
+  REQUIRE(flags.DoBoundsChecks(false) == false);
+  REQUIRE(flags.DoBoundsChecks() == false);
+  REQUIRE(flags.DoBoundsChecks(true) == true);
+  REQUIRE(flags.DoBoundsChecks() == true);
+
+  REQUIRE(flags.DoHoistBoundsChecks() == false);
+  REQUIRE(flags.DoHoistBoundsChecks(true) == true);
+  REQUIRE(flags.DoHoistBoundsChecks() == true);
+  REQUIRE(flags.DoHoistBoundsChecks(false) == false);
+  REQUIRE(flags.DoHoistBoundsChecks() == false);
+
+  REQUIRE(flags.DoFunctionSections() == false);
+  REQUIRE(flags.DoFunctionSections(true) == true);
+  REQUIRE(flags.DoFunctionSections() == true);
+  REQUIRE(flags.DoFunctionSections(false) == false);
+  REQUIRE(flags.DoFunctionSections() == false);
+
+  REQUIRE(flags.DoPositionIndependentCode() == false);
+  REQUIRE(flags.DoPositionIndependentCode(true) == true);
+  REQUIRE(flags.DoPositionIndependentCode() == true);
+  REQUIRE(flags.DoPositionIndependentCode(false) == false);
+  REQUIRE(flags.DoPositionIndependentCode() == false);
+
+  REQUIRE(flags.DoProfileGenerate() == false);
+  REQUIRE(flags.DoProfileGenerate(true) == true);
+  REQUIRE(flags.DoProfileGenerate() == true);
+  REQUIRE(flags.DoProfileGenerate(false) == false);
+  REQUIRE(flags.DoProfileGenerate() == false);
+
+  REQUIRE(flags.DoPrintPassTimings() == false);
+  REQUIRE(flags.DoPrintPassTimings(true) == true);
+  REQUIRE(flags.DoPrintPassTimings() == true);
+  REQUIRE(flags.DoPrintPassTimings(false) == false);
+  REQUIRE(flags.DoPrintPassTimings() == false);
+
+  REQUIRE(flags.DoOptimizeDebug() == false);
+  REQUIRE(flags.DoOptimizeDebug(true) == true);
+  REQUIRE(flags.DoOptimizeDebug() == true);
+  REQUIRE(flags.DoOptimizeDebug(false) == false);
+  REQUIRE(flags.DoOptimizeDebug() == false);
+
+  REQUIRE(flags.DoVerify() == true);
+  REQUIRE(flags.DoVerify(false) == false);
+  REQUIRE(flags.DoVerify() == false);
+  REQUIRE(flags.DoVerify(true) == true);
+  REQUIRE(flags.DoVerify() == true);
+
+  REQUIRE(flags.DoCheckAll() == false);
+  REQUIRE(flags.DoCheckAll(true) == true);
+  REQUIRE(flags.DoCheckAll() == true);
+  REQUIRE(flags.DoCheckAll(false) == false);
+  REQUIRE(flags.DoCheckAll() == false);
+
+  REQUIRE(flags.DoWholeProgram() == false);
+  REQUIRE(flags.DoWholeProgram(true) == true);
+  REQUIRE(flags.DoWholeProgram() == true);
+  REQUIRE(flags.DoWholeProgram(false) == false);
+  REQUIRE(flags.DoWholeProgram() == false);
+
+  REQUIRE(flags.DoFastMath() == false);
+  REQUIRE(flags.DoFastMath(true) == true);
+  REQUIRE(flags.DoFastMath() == true);
+  REQUIRE(flags.DoFastMath(false) == false);
+  REQUIRE(flags.DoFastMath() == false);
 }
 
 // #TODO rewrite this test case
@@ -56,13 +143,35 @@ TEST_CASE("aux/CLIOptions", "[unit][aux]") {
                            llvm::OptimizationLevel::O1};
 
   REQUIRE(options.DoEmitAssembly() == false);
-  REQUIRE(options.DoEmitObject() == true);
+  REQUIRE(options.DoEmitObject() == false);
   REQUIRE(options.DoLink() == true);
+  REQUIRE(options.DoRun() == false);
+  REQUIRE(options.DoEmitBitcode() == false);
+  REQUIRE(options.DoLinkTimeOptimization() == false);
+  REQUIRE(options.DoBoundsChecks() == true);
+  REQUIRE(options.DoHoistBoundsChecks() == false);
+  REQUIRE(options.DoFunctionSections() == false);
+  REQUIRE(options.DoPositionIndependentCode() == false);
   REQUIRE(options.GetOptimizationLevel() == llvm::OptimizationLevel::O1);
+  REQUIRE(options.GetCodeGenOptLevel() == llvm::CodeGenOpt::Less);
+  REQUIRE(options.GetTargetCPU() == pink::CLIOptions::native_cpu);
+  REQUIRE(options.GetTargetFeatures().empty());
+  REQUIRE(options.GetPasses().empty());
+  REQUIRE(options.DoPrintPassTimings() == false);
+  REQUIRE(options.DoOptimizeDebug() == false);
+  REQUIRE(options.DoVerify() == true);
+  REQUIRE(options.DoCheckAll() == false);
+  REQUIRE(options.GetExports().empty());
+  REQUIRE(options.DoWholeProgram() == false);
+  REQUIRE(options.DoFastMath() == false);
   REQUIRE(options.GetInputFile() == infile);
   REQUIRE(options.GetExecutableFile() == outfile);
   REQUIRE(options.GetAssemblyFile() == outfile + ".s");
   REQUIRE(options.GetObjectFile() == outfile + ".o");
+  REQUIRE(options.GetBitcodeFile() == outfile + ".bc");
+  REQUIRE(options.DoProfileGenerate() == false);
+  REQUIRE(options.DoProfileUse() == false);
+  REQUIRE(options.GetProfileGenerateFile() == outfile + ".profraw");
 
   std::stringstream version;
   pink::CLIOptions::PrintVersion(version);
@@ -71,4 +180,33 @@ TEST_CASE("aux/CLIOptions", "[unit][aux]") {
   std::stringstream help;
   pink::CLIOptions::PrintHelp(help);
   REQUIRE(!help.str().empty());
-}
\ No newline at end of file
+}
+
+static auto ParseArguments(std::vector<char const *> arguments)
+    -> pink::Outcome<pink::CLIOptions> {
+  arguments.insert(arguments.begin(), "pink");
+  arguments.emplace_back(nullptr);
+  // getopt_long keeps it's state in globals, which
+  // are reinitialized by setting optind to zero.
+  optind = 0;
+  std::stringstream out;
+  return pink::ParseCLIOptions(
+      out,
+      static_cast<int>(arguments.size() - 1),
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      const_cast<char **>(arguments.data()));
+}
+
+TEST_CASE("aux/ParseCLIOptions", "[unit][aux]") {
+  SECTION("--passes with --profile-generate") {
+    auto outcome = ParseArguments(
+        {"--passes", "default<O2>", "--profile-generate", "infile.p"});
+    REQUIRE(!outcome);
+    REQUIRE(outcome.GetSecond().code == pink::Error::Code::IncompatibleOptions);
+  }
+  SECTION("-Og with --profile-generate") {
+    auto outcome = ParseArguments({"-Og", "--profile-generate", "infile.p"});
+    REQUIRE(!outcome);
+    REQUIRE(outcome.GetSecond().code == pink::Error::Code::IncompatibleOptions);
+  }
+}
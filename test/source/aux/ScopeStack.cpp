@@ -66,4 +66,13 @@ TEST_CASE("aux/SymbolTable", "[unit][aux]") {
 
   found_x = scopes.LookupLocal(variable_x);
   REQUIRE(found_x);
+  REQUIRE(!found_x->IsSSA());
+
+  // SSA variables are bound to their current value
+  const auto *variable_z = string_interner.Intern("z");
+  scopes.Bind(variable_z, type_y, nullptr, /* is_ssa */ true);
+  auto found_z = scopes.Lookup(variable_z);
+  REQUIRE(found_z);
+  REQUIRE(found_z->IsSSA());
+  REQUIRE(found_z->Value() == nullptr);
 }
\ No newline at end of file
@@ -27,7 +27,10 @@ TEST_CASE("front/Lexer", "[unit][front]") {
       "true\n",   "false\n", "Boolean\n", "fn\n",  "if\n",  "then\n",
       "else\n",   "while\n", "do\n",      ".\n",   ",\n",   ";\n",
       ":\n",      "=\n",     ":=\n",      "(\n",   ")\n",   "{\n",
-      "}\n",      "[\n",     "]\n",
+      "}\n",      "[\n",     "]\n",      "for\n", "in\n",  "..\n",
+      "Vector\n", "u8\n",    "i64\n",    "<<\n",  ">>\n",
+      "1.5\n",    "Float32\n", "Float64\n",
+      "arena_alloc\n", "pool_free\n", "mem_compare\n", "print\n",
   };
 
   std::vector<pink::Token> equivalent_tokens = {
@@ -40,6 +43,19 @@ TEST_CASE("front/Lexer", "[unit][front]") {
       pink::Token::Colon,  pink::Token::Assign,   pink::Token::ColonEq,
       pink::Token::LParen, pink::Token::RParen,   pink::Token::LBrace,
       pink::Token::RBrace, pink::Token::LBracket, pink::Token::RBracket,
+      pink::Token::For,    pink::Token::In,       pink::Token::DotDot,
+      pink::Token::VectorType,
+      pink::Token::SizedIntegerType,
+      pink::Token::SizedIntegerType,
+      pink::Token::ShiftLeft,
+      pink::Token::ShiftRight,
+      pink::Token::Float,
+      pink::Token::FloatType,
+      pink::Token::FloatType,
+      pink::Token::Intrinsic,
+      pink::Token::Intrinsic,
+      pink::Token::Intrinsic,
+      pink::Token::Intrinsic,
   };
 
   auto [test_text, source_locations] = [&source_lines]() {
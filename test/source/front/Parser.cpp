@@ -217,4 +217,8 @@ TEST_CASE("front/Parser::ParseFunction", "[unit][front]") {
   SECTION(term_aej) { PARSE(term_aej); }
   SECTION(term_aek) { PARSE(term_aek); }
   SECTION(term_ael) { PARSE(term_ael); }
+
+  SECTION(term_aey) { PARSE(term_aey); }
+  SECTION(term_aez) { PARSE(term_aez); }
+  SECTION(term_afa) { PARSE(term_afa); }
 }
@@ -38,7 +38,10 @@ TEST_CASE("front/Token", "[unit][front]") {
       pink::Token::LessThanOrEqual,
       pink::Token::GreaterThan,
       pink::Token::GreaterThanOrEqual,
+      pink::Token::ShiftLeft,
+      pink::Token::ShiftRight,
       pink::Token::Dot,
+      pink::Token::DotDot,
       pink::Token::Comma,
       pink::Token::Semicolon,
       pink::Token::Colon,
@@ -54,9 +57,13 @@ TEST_CASE("front/Token", "[unit][front]") {
       pink::Token::NilType,
       pink::Token::Integer,
       pink::Token::IntegerType,
+      pink::Token::SizedIntegerType,
+      pink::Token::Float,
+      pink::Token::FloatType,
       pink::Token::True,
       pink::Token::False,
       pink::Token::BooleanType,
+      pink::Token::VectorType,
       pink::Token::Fn,
       pink::Token::Var,
       pink::Token::If,
@@ -64,6 +71,9 @@ TEST_CASE("front/Token", "[unit][front]") {
       pink::Token::Else,
       pink::Token::While,
       pink::Token::Do,
+      pink::Token::For,
+      pink::Token::In,
+      pink::Token::Intrinsic,
   };
   std::vector<const char *> texts = {
       "Token::Error",
@@ -83,7 +93,10 @@ TEST_CASE("front/Token", "[unit][front]") {
       "<=",
       ">",
       ">=",
+      "<<",
+      ">>",
       ".",
+      "..",
       ",",
       ";",
       ":",
@@ -99,9 +112,13 @@ TEST_CASE("front/Token", "[unit][front]") {
       "Nil",
       "Token::Integer",
       "Integer",
+      "Token::SizedIntegerType",
+      "Token::Float",
+      "Token::FloatType",
       "true",
       "false",
       "Boolean",
+      "Vector",
       "fn",
       "var",
       "if",
@@ -109,6 +126,9 @@ TEST_CASE("front/Token", "[unit][front]") {
       "else",
       "while",
       "do",
+      "for",
+      "in",
+      "Token::Intrinsic",
   };
   size_t index = 0;
   for (const auto &token : tokens) {
@@ -52,6 +52,20 @@ TEST_CASE("type/CharacterType", "[unit][type]") {
   REQUIRE(llvm::dyn_cast<pink::CharacterType>(type) != nullptr);
 }
 
+TEST_CASE("type/FloatType", "[unit][type]") {
+  pink::Type::Annotations annotations;
+  auto                    interner = pink::TypeInterner{};
+  const auto             *type     = interner.GetFloatType(annotations, 32);
+  REQUIRE(type->GetKind() == pink::Type::Kind::Float);
+  REQUIRE(llvm::isa<pink::FloatType>(type));
+  const auto *float_type = llvm::dyn_cast<pink::FloatType>(type);
+  REQUIRE(float_type != nullptr);
+  REQUIRE(float_type->GetBitWidth() == 32);
+  REQUIRE(type == interner.GetFloatType(annotations, 32));
+  REQUIRE(type != interner.GetFloatType(annotations, 64));
+  REQUIRE(!type->Equals(interner.GetIntType(annotations)));
+}
+
 TEST_CASE("type/FunctionType", "[unit][type]") {
   pink::Type::Annotations       annotations;
   auto                          interner     = pink::TypeInterner{};
@@ -109,6 +123,21 @@ TEST_CASE("type/PointerType", "[unit][type]") {
   REQUIRE(pointer_type->GetPointeeType() == integer_type);
 }
 
+TEST_CASE("type/SizedIntegerType", "[unit][type]") {
+  pink::Type::Annotations annotations;
+  auto                    interner = pink::TypeInterner{};
+  const auto *type = interner.GetSizedIntType(annotations, 16, false);
+  REQUIRE(type->GetKind() == pink::Type::Kind::SizedInteger);
+  REQUIRE(llvm::isa<pink::SizedIntegerType>(type));
+  const auto *sized_type = llvm::dyn_cast<pink::SizedIntegerType>(type);
+  REQUIRE(sized_type != nullptr);
+  REQUIRE(sized_type->GetBitWidth() == 16);
+  REQUIRE(!sized_type->IsSigned());
+  REQUIRE(type == interner.GetSizedIntType(annotations, 16, false));
+  REQUIRE(type != interner.GetSizedIntType(annotations, 16, true));
+  REQUIRE(!type->Equals(interner.GetIntType(annotations)));
+}
+
 TEST_CASE("type/SliceType", "[unit][type]") {
   pink::Type::Annotations annotations;
   auto                    interner     = pink::TypeInterner{};
@@ -136,6 +165,26 @@ TEST_CASE("type/TupleType", "[unit][type]") {
   }
 }
 
+TEST_CASE("type/VectorType", "[unit][type]") {
+  pink::Type::Annotations annotations;
+  auto                    interner      = pink::TypeInterner{};
+  const auto             *integer_type  = interner.GetIntType(annotations);
+  size_t                  vector_length = 4;
+  const auto             *type =
+      interner.GetVectorType(annotations, vector_length, integer_type);
+  REQUIRE(type->GetKind() == pink::Type::Kind::Vector);
+  REQUIRE(llvm::isa<pink::VectorType>(type));
+  const auto *vector_type = llvm::dyn_cast<pink::VectorType>(type);
+  REQUIRE(vector_type != nullptr);
+  REQUIRE(vector_type->GetElementType() == integer_type);
+  REQUIRE(vector_type->GetLength() == vector_length);
+  REQUIRE(type == interner.GetVectorType(annotations,
+                                         vector_length,
+                                         integer_type));
+  REQUIRE(pink::VectorType::IsElementType(integer_type));
+  REQUIRE(!pink::VectorType::IsElementType(type));
+}
+
 TEST_CASE("type/VoidType", "[unit][type]") {
   pink::Type::Annotations annotations;
   auto                    interner = pink::TypeInterner{};